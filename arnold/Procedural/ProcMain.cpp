@@ -46,6 +46,7 @@
 #include <Alembic/AbcCoreHDF5/ReadWrite.h>
 #include <Alembic/AbcCoreOgawa/ReadWrite.h>
 #include <Alembic/AbcCoreFactory/IFactory.h>
+#include <Alembic/AbcCoreFactory/ArchivePool.h>
 #include <ai.h>
 
 namespace
@@ -278,8 +279,10 @@ int ProcInit( struct AtNode *node, void **user_ptr )
     }
     // AiMsgInfo("[bb_AlembicArnoldProcedural] Loading archive ");
 
+    // every procedural for the same file shares one open archive
     Alembic::AbcCoreFactory::IFactory factory;
     factory.setPolicy(Alembic::Abc::ErrorHandler::kQuietNoopPolicy);
+    factory.setArchivePool(Alembic::AbcCoreFactory::ArchivePool::getShared());
     // AiMsgInfo("[bb_AlembicArnoldProcedural] Loading archive : %s", args->filename);
 
     IArchive archive( factory.getArchive(args->filename) );
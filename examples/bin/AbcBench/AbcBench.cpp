@@ -0,0 +1,784 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+// Micro-benchmarks for the Ogawa core and the Abc read and write paths.
+//
+// Synthetic archives are written from a fixed recipe, so runs on different
+// builds or machines measure the same data.  Every measurement is printed
+// as one JSON object per line so results can be diffed, plotted or
+// checked for regressions by scripts.
+
+#include <Alembic/Abc/All.h>
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/AbcCoreFactory/All.h>
+#include <Alembic/Util/ThreadPool.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef _MSC_VER
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+
+namespace Abc  = ::Alembic::Abc;
+namespace AbcA = ::Alembic::AbcCoreAbstract;
+namespace AbcF = ::Alembic::AbcCoreFactory;
+namespace AbcU = ::Alembic::Util;
+
+using AbcA::index_t;
+
+//-*****************************************************************************
+double getTimeSec()
+{
+#ifdef _MSC_VER
+    LARGE_INTEGER freq;
+    LARGE_INTEGER count;
+    QueryPerformanceFrequency( &freq );
+    QueryPerformanceCounter( &count );
+    return ( double ) count.QuadPart / ( double ) freq.QuadPart;
+#else
+    timeval t;
+    gettimeofday( &t, 0 );
+    return ( double ) t.tv_sec + ( double ) t.tv_usec / 1000000.0;
+#endif
+}
+
+//-*****************************************************************************
+struct Options
+{
+    Options()
+      : scale( 1 ), repeats( 3 ), maxThreads( 4 ), numFrames( 24 )
+      , compression( -1 ), directory( "." ), keepFiles( false ) {}
+
+    std::size_t scale;
+    std::size_t repeats;
+    std::size_t maxThreads;
+    std::size_t numFrames;
+    int compression;
+    std::string directory;
+    std::string only;
+    bool keepFiles;
+};
+
+//-*****************************************************************************
+// Prints one result as a line of JSON
+class Reporter
+{
+public:
+    Reporter( std::ostream & iOut ) : m_out( iOut )
+    {
+        m_out.precision( 12 );
+    }
+
+    void report( const std::string & iScenario, const std::string & iMetric,
+                 double iValue, const std::string & iUnit,
+                 std::size_t iThreads = 1,
+                 const std::string & iStrategy = "" )
+    {
+        m_out << "{\"scenario\": \"" << iScenario
+              << "\", \"metric\": \"" << iMetric
+              << "\", \"value\": " << iValue
+              << ", \"unit\": \"" << iUnit
+              << "\", \"threads\": " << iThreads;
+
+        if ( !iStrategy.empty() )
+        {
+            m_out << ", \"strategy\": \"" << iStrategy << "\"";
+        }
+
+        m_out << "}" << std::endl;
+    }
+
+private:
+    std::ostream & m_out;
+};
+
+//-*****************************************************************************
+// Strings are counted by their characters rather than their sizeof
+std::size_t countBytes( const std::string * iStrings, std::size_t iNum )
+{
+    std::size_t numBytes = 0;
+    for ( std::size_t i = 0; i < iNum; ++i )
+    {
+        numBytes += iStrings[i].size();
+    }
+    return numBytes;
+}
+
+template <class SAMP>
+std::size_t countBytes( const SAMP & iSamp )
+{
+    return iSamp.size() * sizeof( typename SAMP::value_type );
+}
+
+std::size_t countBytes( const Abc::StringArraySample & iSamp )
+{
+    return countBytes( iSamp.get(), iSamp.size() );
+}
+
+//-*****************************************************************************
+// What was handed to the writer, so the dedup hit rate can be worked out
+struct WriteStats
+{
+    WriteStats() : numArraySamples( 0 ), numBytes( 0 ) {}
+
+    template <class PROP, class SAMP>
+    void set( PROP & iProp, const SAMP & iSamp )
+    {
+        iProp.set( iSamp );
+        ++numArraySamples;
+        numBytes += countBytes( iSamp );
+
+        uniqueKeys.insert( iSamp.getKey() );
+    }
+
+    std::size_t numArraySamples;
+    std::size_t numBytes;
+    std::set< AbcA::ArraySampleKey > uniqueKeys;
+};
+
+//-*****************************************************************************
+// Deep hierarchy, a long chain of objects each with a little animation
+void writeDeep( Abc::OObject & iTop, uint32_t iTsIdx, const Options & iOpts,
+                WriteStats & oStats )
+{
+    std::size_t depth = 250 * iOpts.scale;
+    std::vector< Abc::ODoubleProperty > props;
+    Abc::OObject parent = iTop;
+    for ( std::size_t i = 0; i < depth; ++i )
+    {
+        std::ostringstream name;
+        name << "deep" << i;
+        Abc::OObject child( parent, name.str() );
+        props.push_back( Abc::ODoubleProperty( child.getProperties(),
+                                               "value", iTsIdx ) );
+        parent = child;
+    }
+
+    for ( std::size_t f = 0; f < iOpts.numFrames; ++f )
+    {
+        for ( std::size_t i = 0; i < props.size(); ++i )
+        {
+            props[i].set( ( double ) ( f * depth + i ) );
+        }
+    }
+}
+
+//-*****************************************************************************
+// One object with a very wide compound of small arrays, half of which never
+// change
+void writeWide( Abc::OObject & iTop, uint32_t iTsIdx, const Options & iOpts,
+                WriteStats & oStats )
+{
+    std::size_t width = 2000 * iOpts.scale;
+    Abc::OObject obj( iTop, "wide" );
+    Abc::OCompoundProperty wide( obj.getProperties(), "wide" );
+    std::vector< Abc::ODoubleArrayProperty > props;
+    for ( std::size_t i = 0; i < width; ++i )
+    {
+        std::ostringstream name;
+        name << "prop" << i;
+        props.push_back( Abc::ODoubleArrayProperty( wide, name.str(),
+                                                    iTsIdx ) );
+    }
+
+    std::vector< double > vals( 16 );
+    for ( std::size_t f = 0; f < iOpts.numFrames; ++f )
+    {
+        for ( std::size_t i = 0; i < props.size(); ++i )
+        {
+            std::size_t frame = ( i % 2 ) ? f : 0;
+            for ( std::size_t j = 0; j < vals.size(); ++j )
+            {
+                vals[j] = ( double ) ( frame * 100 + i * 16 + j );
+            }
+            oStats.set( props[i], Abc::DoubleArraySample( vals ) );
+        }
+    }
+}
+
+//-*****************************************************************************
+// A few objects with big float arrays, every third frame holds the same
+// values as the first one
+void writeBigArrays( Abc::OObject & iTop, uint32_t iTsIdx,
+                     const Options & iOpts, WriteStats & oStats )
+{
+    std::size_t numObjects = 4;
+    std::size_t numFloats = 250000 * iOpts.scale;
+    std::vector< Abc::OFloatArrayProperty > props;
+    for ( std::size_t i = 0; i < numObjects; ++i )
+    {
+        std::ostringstream name;
+        name << "big" << i;
+        Abc::OObject obj( iTop, name.str() );
+        props.push_back( Abc::OFloatArrayProperty( obj.getProperties(), "P",
+                                                   iTsIdx ) );
+    }
+
+    std::vector< float > vals( numFloats );
+    for ( std::size_t f = 0; f < iOpts.numFrames; ++f )
+    {
+        std::size_t frame = ( f % 3 == 0 ) ? 0 : f;
+        for ( std::size_t i = 0; i < props.size(); ++i )
+        {
+            for ( std::size_t j = 0; j < numFloats; ++j )
+            {
+                vals[j] = ( float ) ( j % 1000 ) * 0.01f +
+                          ( float ) ( frame * numObjects + i ) * 0.5f;
+            }
+            oStats.set( props[i], Abc::FloatArraySample( vals ) );
+        }
+    }
+}
+
+//-*****************************************************************************
+// Lots of objects with many animated scalars each
+void writeScalars( Abc::OObject & iTop, uint32_t iTsIdx,
+                   const Options & iOpts, WriteStats & oStats )
+{
+    std::size_t numObjects = 100 * iOpts.scale;
+    std::size_t numProps = 50;
+    std::vector< Abc::OInt32Property > ints;
+    std::vector< Abc::OFloatProperty > floats;
+    for ( std::size_t i = 0; i < numObjects; ++i )
+    {
+        std::ostringstream name;
+        name << "scalars" << i;
+        Abc::OObject obj( iTop, name.str() );
+        for ( std::size_t j = 0; j < numProps; j += 2 )
+        {
+            std::ostringstream intName, floatName;
+            intName << "i" << j;
+            floatName << "f" << j;
+            ints.push_back( Abc::OInt32Property( obj.getProperties(),
+                                                 intName.str(), iTsIdx ) );
+            floats.push_back( Abc::OFloatProperty( obj.getProperties(),
+                                                   floatName.str(), iTsIdx ) );
+        }
+    }
+
+    for ( std::size_t f = 0; f < iOpts.numFrames; ++f )
+    {
+        for ( std::size_t i = 0; i < ints.size(); ++i )
+        {
+            ints[i].set( ( int32_t ) ( f + i ) );
+            floats[i].set( ( float ) ( f + i ) * 0.25f );
+        }
+    }
+}
+
+//-*****************************************************************************
+// Objects with arrays of names, where the names are mostly repeated
+void writeStrings( Abc::OObject & iTop, uint32_t iTsIdx,
+                   const Options & iOpts, WriteStats & oStats )
+{
+    std::size_t numObjects = 50;
+    std::size_t numStrings = 1000 * iOpts.scale;
+    std::vector< Abc::OStringArrayProperty > props;
+    for ( std::size_t i = 0; i < numObjects; ++i )
+    {
+        std::ostringstream name;
+        name << "strings" << i;
+        Abc::OObject obj( iTop, name.str() );
+        props.push_back( Abc::OStringArrayProperty( obj.getProperties(),
+                                                    "names", iTsIdx ) );
+    }
+
+    std::vector< std::string > vals( numStrings );
+    for ( std::size_t f = 0; f < iOpts.numFrames; ++f )
+    {
+        for ( std::size_t i = 0; i < props.size(); ++i )
+        {
+            std::size_t frame = f / 4;
+            for ( std::size_t j = 0; j < numStrings; ++j )
+            {
+                std::ostringstream val;
+                val << "/world/geo/group" << ( j % 37 ) << "/shape" << j
+                    << "_" << ( frame + i % 5 );
+                vals[j] = val.str();
+            }
+            oStats.set( props[i], Abc::StringArraySample( vals ) );
+        }
+    }
+}
+
+//-*****************************************************************************
+typedef void ( *WriteFunc )( Abc::OObject &, uint32_t, const Options &,
+                             WriteStats & );
+
+struct Scenario
+{
+    const char * name;
+    WriteFunc write;
+};
+
+static const Scenario kScenarios[] = {
+    { "deep", writeDeep },
+    { "wide", writeWide },
+    { "bigarrays", writeBigArrays },
+    { "scalars", writeScalars },
+    { "strings", writeStrings }
+};
+
+static const std::size_t kNumScenarios =
+    sizeof( kScenarios ) / sizeof( kScenarios[0] );
+
+//-*****************************************************************************
+std::size_t getFileSize( const std::string & iFileName )
+{
+    std::ifstream file( iFileName.c_str(),
+                        std::ios::in | std::ios::binary | std::ios::ate );
+    return file ? ( std::size_t ) file.tellg() : 0;
+}
+
+//-*****************************************************************************
+// Everything that has samples to read, found while walking the hierarchy
+struct Walked
+{
+    Walked() : numObjects( 0 ), numProperties( 0 ) {}
+
+    std::size_t numObjects;
+    std::size_t numProperties;
+    std::vector< Abc::IArrayProperty > arrays;
+    std::vector< Abc::IScalarProperty > scalars;
+};
+
+//-*****************************************************************************
+void walkProperties( Abc::ICompoundProperty iParent, Walked & oWalked )
+{
+    for ( std::size_t i = 0; i < iParent.getNumProperties(); ++i )
+    {
+        const AbcA::PropertyHeader & header = iParent.getPropertyHeader( i );
+        ++oWalked.numProperties;
+
+        if ( header.isCompound() )
+        {
+            walkProperties( Abc::ICompoundProperty( iParent,
+                                                    header.getName() ),
+                            oWalked );
+        }
+        else if ( header.isArray() )
+        {
+            oWalked.arrays.push_back( Abc::IArrayProperty( iParent,
+                header.getName() ) );
+        }
+        else
+        {
+            oWalked.scalars.push_back( Abc::IScalarProperty( iParent,
+                header.getName() ) );
+        }
+    }
+}
+
+//-*****************************************************************************
+void walkObjects( Abc::IObject iObj, Walked & oWalked )
+{
+    ++oWalked.numObjects;
+    walkProperties( iObj.getProperties(), oWalked );
+    for ( std::size_t i = 0; i < iObj.getNumChildren(); ++i )
+    {
+        walkObjects( iObj.getChild( i ), oWalked );
+    }
+}
+
+//-*****************************************************************************
+// One property sample to be read
+struct WorkItem
+{
+    bool isArray;
+    std::size_t prop;
+    index_t index;
+};
+
+//-*****************************************************************************
+// Reads a slice of the work items, adding up the bytes it got back
+class ReadTask : public AbcU::Task
+{
+public:
+    ReadTask( Walked & iWalked, const std::vector< WorkItem > & iItems,
+              std::size_t iStart, std::size_t iEnd )
+      : m_walked( iWalked ), m_items( iItems )
+      , m_start( iStart ), m_end( iEnd ), m_numBytes( 0 ) {}
+
+    void run()
+    {
+        std::vector< char > buffer;
+        std::vector< std::string > strings;
+        for ( std::size_t i = m_start; i < m_end; ++i )
+        {
+            const WorkItem & item = m_items[i];
+            if ( item.isArray )
+            {
+                Abc::IArrayProperty & prop = m_walked.arrays[item.prop];
+                AbcA::ArraySamplePtr samp;
+                prop.get( samp, Abc::ISampleSelector( item.index ) );
+                const AbcA::DataType & dtype = samp->getDataType();
+                if ( dtype.getPod() == AbcU::kStringPOD )
+                {
+                    m_numBytes += countBytes(
+                        static_cast< const std::string * >( samp->getData() ),
+                        samp->size() * dtype.getExtent() );
+                }
+                else
+                {
+                    m_numBytes += samp->size() * dtype.getNumBytes();
+                }
+            }
+            else
+            {
+                Abc::IScalarProperty & prop = m_walked.scalars[item.prop];
+                const AbcA::DataType & dtype = prop.getDataType();
+                if ( dtype.getPod() == AbcU::kStringPOD )
+                {
+                    strings.resize( dtype.getExtent() );
+                    prop.get( &strings.front(),
+                              Abc::ISampleSelector( item.index ) );
+                    m_numBytes += countBytes( &strings.front(),
+                                               strings.size() );
+                }
+                else
+                {
+                    buffer.resize( dtype.getNumBytes() );
+                    prop.get( &buffer.front(),
+                              Abc::ISampleSelector( item.index ) );
+                    m_numBytes += dtype.getNumBytes();
+                }
+            }
+        }
+    }
+
+    std::size_t getNumBytes() const { return m_numBytes; }
+
+private:
+    Walked & m_walked;
+    const std::vector< WorkItem > & m_items;
+    std::size_t m_start;
+    std::size_t m_end;
+    std::size_t m_numBytes;
+};
+
+//-*****************************************************************************
+AbcF::IFactory makeFactory( std::size_t iNumStreams,
+                            AbcF::IFactory::OgawaReadStrategy iStrategy )
+{
+    AbcF::IFactory factory;
+    factory.setOgawaNumStreams( iNumStreams );
+    factory.setOgawaReadStrategy( iStrategy );
+
+    // every read should go to the archive
+    factory.setSampleCache( AbcA::ReadArraySampleCachePtr() );
+    return factory;
+}
+
+//-*****************************************************************************
+void benchWrite( const Scenario & iScenario, const std::string & iFileName,
+                 const Options & iOpts, Reporter & ioReporter )
+{
+    WriteStats stats;
+    double start = getTimeSec();
+    {
+        Abc::OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+                               iFileName );
+        archive.setCompressionHint( ( int8_t ) iOpts.compression );
+        uint32_t tsIdx = archive.addTimeSampling(
+            AbcA::TimeSampling( 1.0 / 24.0, 0.0 ) );
+        Abc::OObject top = archive.getTop();
+        iScenario.write( top, tsIdx, iOpts, stats );
+    }
+    double seconds = getTimeSec() - start;
+    std::size_t fileSize = getFileSize( iFileName );
+
+    ioReporter.report( iScenario.name, "write_time", seconds, "s" );
+    ioReporter.report( iScenario.name, "file_size", ( double ) fileSize,
+                       "bytes" );
+
+    if ( stats.numArraySamples > 0 )
+    {
+        ioReporter.report( iScenario.name, "write_throughput",
+            ( double ) stats.numBytes / ( 1024.0 * 1024.0 ) / seconds,
+            "MB/s" );
+        ioReporter.report( iScenario.name, "dedup_hit_rate",
+            1.0 - ( double ) stats.uniqueKeys.size() /
+                  ( double ) stats.numArraySamples, "ratio" );
+    }
+}
+
+//-*****************************************************************************
+void benchRead( const Scenario & iScenario, const std::string & iFileName,
+                const Options & iOpts, Reporter & ioReporter )
+{
+    // opening and walking, best of the repeats
+    double bestOpen = -1.0;
+    double bestWalk = -1.0;
+    for ( std::size_t r = 0; r < iOpts.repeats; ++r )
+    {
+        AbcF::IFactory factory = makeFactory( 1, AbcF::IFactory::kFileStreams );
+
+        double start = getTimeSec();
+        Abc::IArchive archive = factory.getArchive( iFileName );
+        Abc::IObject top = archive.getTop();
+        double openTime = getTimeSec() - start;
+
+        Walked walked;
+        start = getTimeSec();
+        walkObjects( top, walked );
+        double walkTime = getTimeSec() - start;
+
+        if ( bestOpen < 0.0 || openTime < bestOpen ) { bestOpen = openTime; }
+        if ( bestWalk < 0.0 || walkTime < bestWalk ) { bestWalk = walkTime; }
+
+        if ( r == 0 )
+        {
+            ioReporter.report( iScenario.name, "num_objects",
+                               ( double ) walked.numObjects, "count" );
+            ioReporter.report( iScenario.name, "num_properties",
+                               ( double ) walked.numProperties, "count" );
+        }
+    }
+
+    ioReporter.report( iScenario.name, "open_time", bestOpen, "s" );
+    ioReporter.report( iScenario.name, "walk_time", bestWalk, "s" );
+
+    // reading every sample at 1, 2, 4 ... threads with as many streams
+    AbcF::IFactory::OgawaReadStrategy strategies[2] = {
+        AbcF::IFactory::kFileStreams, AbcF::IFactory::kMemoryMappedFiles };
+    const char * strategyNames[2] = { "streams", "mmap" };
+
+    for ( std::size_t s = 0; s < 2; ++s )
+    {
+        for ( std::size_t threads = 1; threads <= iOpts.maxThreads;
+              threads *= 2 )
+        {
+            AbcF::IFactory factory = makeFactory( threads, strategies[s] );
+            Abc::IArchive archive = factory.getArchive( iFileName );
+            Walked walked;
+            walkObjects( archive.getTop(), walked );
+
+            std::vector< WorkItem > items;
+            for ( std::size_t i = 0; i < walked.arrays.size(); ++i )
+            {
+                WorkItem item = { true, i, 0 };
+                for ( item.index = 0; item.index < ( index_t )
+                      walked.arrays[i].getNumSamples(); ++item.index )
+                {
+                    items.push_back( item );
+                }
+            }
+            for ( std::size_t i = 0; i < walked.scalars.size(); ++i )
+            {
+                WorkItem item = { false, i, 0 };
+                for ( item.index = 0; item.index < ( index_t )
+                      walked.scalars[i].getNumSamples(); ++item.index )
+                {
+                    items.push_back( item );
+                }
+            }
+
+            if ( items.empty() )
+            {
+                break;
+            }
+
+            double best = -1.0;
+            std::size_t numBytes = 0;
+            for ( std::size_t r = 0; r < iOpts.repeats; ++r )
+            {
+                AbcU::ThreadPool pool( threads );
+                std::vector< AbcU::shared_ptr< ReadTask > > tasks;
+                double start = getTimeSec();
+                for ( std::size_t t = 0; t < threads; ++t )
+                {
+                    AbcU::shared_ptr< ReadTask > task( new ReadTask( walked,
+                        items, ( items.size() * t ) / threads,
+                        ( items.size() * ( t + 1 ) ) / threads ) );
+                    tasks.push_back( task );
+                    pool.add( task );
+                }
+                pool.wait();
+                double seconds = getTimeSec() - start;
+
+                numBytes = 0;
+                for ( std::size_t t = 0; t < tasks.size(); ++t )
+                {
+                    numBytes += tasks[t]->getNumBytes();
+                }
+
+                if ( best < 0.0 || seconds < best ) { best = seconds; }
+            }
+
+            ioReporter.report( iScenario.name, "read_time", best, "s",
+                               threads, strategyNames[s] );
+            ioReporter.report( iScenario.name, "read_throughput",
+                ( double ) numBytes / ( 1024.0 * 1024.0 ) / best, "MB/s",
+                threads, strategyNames[s] );
+            ioReporter.report( iScenario.name, "read_samples_per_second",
+                ( double ) items.size() / best, "samples/s",
+                threads, strategyNames[s] );
+        }
+    }
+}
+
+//-*****************************************************************************
+void printUsage( const char * iName )
+{
+    std::cerr << "Usage: " << iName << " [options]\n\n"
+              << "Writes synthetic archives and prints one JSON object per "
+              << "measurement.\n\n"
+              << "  -d dir       where the archives are written (.)\n"
+              << "  -o file      write the results to file instead of stdout\n"
+              << "  -s scale     multiplies the size of every archive (1)\n"
+              << "  -f frames    number of samples per property (24)\n"
+              << "  -t threads   the most read threads, doubling from 1 (4)\n"
+              << "  -r repeats   runs per measurement, the best is kept (3)\n"
+              << "  -c level     compression hint, -1 for none (-1)\n"
+              << "  -k scenario  only run one of:";
+    for ( std::size_t i = 0; i < kNumScenarios; ++i )
+    {
+        std::cerr << " " << kScenarios[i].name;
+    }
+    std::cerr << "\n  -K           keep the archives afterwards" << std::endl;
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    Options opts;
+    std::string outFileName;
+
+    for ( int i = 1; i < argc; ++i )
+    {
+        std::string arg = argv[i];
+        bool hasValue = ( i + 1 < argc );
+
+        if ( arg == "-K" )
+        {
+            opts.keepFiles = true;
+        }
+        else if ( arg == "-d" && hasValue ) { opts.directory = argv[++i]; }
+        else if ( arg == "-o" && hasValue ) { outFileName = argv[++i]; }
+        else if ( arg == "-k" && hasValue ) { opts.only = argv[++i]; }
+        else if ( arg == "-s" && hasValue ) { opts.scale = atoi( argv[++i] ); }
+        else if ( arg == "-f" && hasValue )
+        {
+            opts.numFrames = atoi( argv[++i] );
+        }
+        else if ( arg == "-t" && hasValue )
+        {
+            opts.maxThreads = atoi( argv[++i] );
+        }
+        else if ( arg == "-r" && hasValue )
+        {
+            opts.repeats = atoi( argv[++i] );
+        }
+        else if ( arg == "-c" && hasValue )
+        {
+            opts.compression = atoi( argv[++i] );
+        }
+        else
+        {
+            printUsage( argv[0] );
+            return 1;
+        }
+    }
+
+    if ( opts.scale < 1 || opts.numFrames < 1 || opts.maxThreads < 1 ||
+         opts.repeats < 1 || opts.compression < -1 || opts.compression > 9 )
+    {
+        printUsage( argv[0] );
+        return 1;
+    }
+
+    std::ofstream outFile;
+    if ( !outFileName.empty() )
+    {
+        outFile.open( outFileName.c_str() );
+        if ( !outFile )
+        {
+            std::cerr << "Couldn't open " << outFileName << std::endl;
+            return 1;
+        }
+    }
+
+    Reporter reporter( outFileName.empty() ? std::cout : outFile );
+
+    bool ranAny = false;
+    for ( std::size_t i = 0; i < kNumScenarios; ++i )
+    {
+        const Scenario & scenario = kScenarios[i];
+        if ( !opts.only.empty() && opts.only != scenario.name )
+        {
+            continue;
+        }
+
+        ranAny = true;
+        std::string fileName = opts.directory + "/abcbench_" +
+            scenario.name + ".abc";
+
+        try
+        {
+            benchWrite( scenario, fileName, opts, reporter );
+            benchRead( scenario, fileName, opts, reporter );
+        }
+        catch ( std::exception & e )
+        {
+            std::cerr << scenario.name << " failed: " << e.what()
+                      << std::endl;
+            return 1;
+        }
+
+        if ( !opts.keepFiles )
+        {
+            remove( fileName.c_str() );
+        }
+    }
+
+    if ( !ranAny )
+    {
+        std::cerr << "Unknown scenario: " << opts.only << std::endl;
+        printUsage( argv[0] );
+        return 1;
+    }
+
+    return 0;
+}
@@ -46,6 +46,7 @@
 #include <vector>
 #include <algorithm>
 #include <string>
+#include <cstdlib>
 
 using namespace Alembic::AbcGeom;
 using namespace Alembic::AbcCoreAbstract;
@@ -244,6 +245,28 @@ void init(std::vector< IObject > & iObjects, OObject & oParentObj,
     }
 }
 
+// used instead of stitching the geometry schemas sample by sample when the
+// inputs are read on several threads, copying them property by property
+// lets every array sample be read ahead of where it's being written
+template< class IData, class IDataSchema, class OData, class ODataSchema >
+OObject stitchSchema(std::vector< IObject > & iObjects, OObject & oParentObj)
+{
+    ODataSchema oSchema;
+    init< IData, IDataSchema, OData, ODataSchema >(iObjects, oParentObj,
+                                                   oSchema);
+
+    ICompoundPropertyVec iSchemaProps;
+    iSchemaProps.reserve(iObjects.size());
+    for (size_t i = 0; i < iObjects.size(); i++)
+    {
+        iSchemaProps.push_back(
+            IData(iObjects[i], Alembic::Abc::kWrapExisting).getSchema());
+    }
+
+    stitchSchemaProps(iSchemaProps, oSchema);
+    return oSchema.getObject();
+}
+
 };
 
 //-*****************************************************************************
@@ -316,6 +339,41 @@ void visitObjects(std::vector< IObject > & iObjects, OObject & oParentObj)
                              oCompoundProp);
         }
     }
+    else if (usingReadThreads() && ISubD::matches(header))
+    {
+        outObj = stitchSchema< ISubD,
+                               ISubDSchema,
+                               OSubD,
+                               OSubDSchema >(iObjects, oParentObj);
+    }
+    else if (usingReadThreads() && IPolyMesh::matches(header))
+    {
+        outObj = stitchSchema< IPolyMesh,
+                               IPolyMeshSchema,
+                               OPolyMesh,
+                               OPolyMeshSchema >(iObjects, oParentObj);
+    }
+    else if (usingReadThreads() && ICurves::matches(header))
+    {
+        outObj = stitchSchema< ICurves,
+                               ICurvesSchema,
+                               OCurves,
+                               OCurvesSchema >(iObjects, oParentObj);
+    }
+    else if (usingReadThreads() && IPoints::matches(header))
+    {
+        outObj = stitchSchema< IPoints,
+                               IPointsSchema,
+                               OPoints,
+                               OPointsSchema >(iObjects, oParentObj);
+    }
+    else if (usingReadThreads() && INuPatch::matches(header))
+    {
+        outObj = stitchSchema< INuPatch,
+                               INuPatchSchema,
+                               ONuPatch,
+                               ONuPatchSchema >(iObjects, oParentObj);
+    }
     else if (ISubD::matches(header))
     {
         OSubDSchema oSchema;
@@ -746,15 +804,27 @@ void visitObjects(std::vector< IObject > & iObjects, OObject & oParentObj)
 //-*****************************************************************************
 int main( int argc, char *argv[] )
 {
-    if (argc < 4)
+    // -j reads the inputs on that many threads, or one per core if it's 0
+    int firstArg = 1;
+    bool readInParallel = false;
+    size_t numReadThreads = 0;
+    if (argc > 2 && std::string(argv[1]) == "-j")
+    {
+        readInParallel = true;
+        numReadThreads = atoi(argv[2]);
+        firstArg = 3;
+    }
+
+    if (argc - firstArg < 3)
     {
-        std::cerr << "USAGE: " << argv[0] << " outFile.abc inFile1.abc"
-            << " inFile2.abc (inFile3.abc ...)" << std::endl;
+        std::cerr << "USAGE: " << argv[0] << " [-j numThreads] outFile.abc"
+            << " inFile1.abc inFile2.abc (inFile3.abc ...)" << std::endl;
         return -1;
     }
 
     {
-        size_t numInputs = argc - 2;
+        int firstInput = firstArg + 1;
+        size_t numInputs = argc - firstInput;
         std::vector< chrono_t > minVec;
 
         minVec.reserve(numInputs);
@@ -769,7 +839,18 @@ int main( int argc, char *argv[] )
         factory.setPolicy(ErrorHandler::kThrowPolicy);
         Alembic::AbcCoreFactory::IFactory::CoreType coreType;
 
-        for (int i = 2; i < argc; ++i)
+        // whether every input can be read from many threads at once
+        bool concurrentReads = true;
+
+        if (readInParallel)
+        {
+            // enough streams for every thread to read the same archive
+            // without waiting on each other
+            factory.setOgawaNumStreams(numReadThreads > 0 ? numReadThreads :
+                Alembic::Util::ThreadPool::getNumCores());
+        }
+
+        for (int i = firstInput; i < argc; ++i)
         {
 
             IArchive archive = factory.getArchive(argv[i], coreType);
@@ -782,7 +863,7 @@ int main( int argc, char *argv[] )
                 return 1;
             }
 
-            if (i == 2)
+            if (i == firstInput)
             {
                 rootChildren = numChildren;
             }
@@ -823,12 +904,12 @@ int main( int argc, char *argv[] )
                 minVec.push_back(min);
                 if (minIndexMap.count(min) == 0)
                 {
-                    minIndexMap.insert(std::make_pair(min, i-2));
+                    minIndexMap.insert(std::make_pair(min, i-firstInput));
                 }
-                else if (argv[2] != argv[i])
+                else if (argv[firstInput] != argv[i])
                 {
                     std::cerr << "ERROR: overlapping frame range between "
-                        << argv[2] << " and " << argv[i] << std::endl;
+                        << argv[firstInput] << " and " << argv[i] << std::endl;
                     return 1;
                 }
             }
@@ -839,6 +920,9 @@ int main( int argc, char *argv[] )
                 return 1;
             }
 
+            concurrentReads = concurrentReads &&
+                archive.getPtr()->supportsConcurrentReads();
+
             iArchives.push_back(archive);
         }
 
@@ -855,7 +939,7 @@ int main( int argc, char *argv[] )
         }
 
         std::string appWriter = "AbcStitcher";
-        std::string fileName = argv[1];
+        std::string fileName = argv[firstArg];
         std::string userStr;
 
         // Create an archive with the default writer
@@ -869,10 +953,24 @@ int main( int argc, char *argv[] )
         else if (coreType == Alembic::AbcCoreFactory::IFactory::kOgawa)
         {
             oArchive = CreateArchiveWithInfo(
-                Alembic::AbcCoreHDF5::WriteArchive(),
+                Alembic::AbcCoreOgawa::WriteArchive(),
                 fileName, appWriter, userStr, ErrorHandler::kThrowPolicy);
         }
 
+        // HDF5 can only be read from one thread at a time, so if any of the
+        // inputs is HDF5 everything is read on this one
+        if (readInParallel && !concurrentReads)
+        {
+            std::cerr << "WARNING: HDF5 archives are read on one thread"
+                << std::endl;
+            readInParallel = false;
+        }
+
+        if (readInParallel)
+        {
+            startReadThreads(numReadThreads);
+        }
+
         OObject oRoot = oArchive.getTop();
         if (!oRoot.valid())
             return -1;
@@ -38,11 +38,187 @@
 
 #include <Alembic/AbcGeom/All.h>
 #include <Alembic/AbcCoreHDF5/All.h>
+#include <Alembic/Util/ThreadPool.h>
 
 using namespace Alembic::AbcGeom;
 using namespace Alembic::Abc;
 using namespace Alembic::AbcCoreAbstract;
 
+namespace {
+
+// reads the array samples ahead of the writer, if it's empty they are read
+// on the calling thread instead
+Alembic::Util::ThreadPoolPtr g_readPool;
+
+// how many samples one read task reads, the writer is never more than one
+// window of these per thread behind the readers
+const size_t kSamplesPerTask = 4;
+
+// one sample of the output array property, and where it comes from
+struct ArraySampleSlot
+{
+    IArrayProperty reader;
+    index_t index;
+    ArraySamplePtr sample;
+    ArraySampleKey key;
+    bool hasKey;
+};
+
+typedef std::vector< ArraySampleSlot > ArraySampleSlotVec;
+
+// reads a run of slots, along with the keys the inputs stored for them so
+// the writer can find the samples it has already written without hashing
+// them again
+class ReadSlotsTask : public Alembic::Util::Task
+{
+public:
+    ReadSlotsTask(ArraySampleSlotVec & iSlots, size_t iBegin, size_t iEnd)
+        : m_slots(iSlots), m_begin(iBegin), m_end(iEnd) {}
+
+    virtual void run()
+    {
+        // neighbouring slots usually come from the same input archive, read
+        // each run of them through one stream
+        Alembic::AbcCoreAbstract::ArchiveReaderPtr archive;
+        Alembic::AbcCoreAbstract::ReadStreamBindingPtr binding;
+
+        for (size_t i = m_begin; i < m_end; ++i)
+        {
+            ArraySampleSlot & slot = m_slots[i];
+
+            Alembic::AbcCoreAbstract::ArchiveReaderPtr slotArchive =
+                slot.reader.getPtr()->getObject()->getArchive();
+            if (slotArchive != archive)
+            {
+                binding.reset();
+                archive = slotArchive;
+                binding = archive->bindReadStream();
+            }
+
+            slot.reader.get(slot.sample, slot.index);
+
+            // only trust the key if it describes the data we just read,
+            // strings are sized differently on disk so they get hashed
+            PlainOldDataType pod = slot.sample->getDataType().getPod();
+            slot.hasKey = pod != Alembic::Util::kStringPOD &&
+                pod != Alembic::Util::kWstringPOD &&
+                slot.reader.getKey(slot.key, slot.index) &&
+                slot.key.numBytes == slot.sample->getDataType().getNumBytes()
+                    * slot.sample->getDimensions().numPoints();
+        }
+    }
+
+private:
+    ArraySampleSlotVec & m_slots;
+    size_t m_begin;
+    size_t m_end;
+};
+
+// starts reading the window of slots which begins at iBegin and returns
+// where it ends
+size_t readSlots(ArraySampleSlotVec & iSlots, size_t iBegin)
+{
+    size_t numTasks = g_readPool ? g_readPool->getNumThreads() : 1;
+    size_t end = std::min(iSlots.size(), iBegin + numTasks * kSamplesPerTask);
+
+    for (size_t i = iBegin; i < end; i += kSamplesPerTask)
+    {
+        Alembic::Util::TaskPtr task(new ReadSlotsTask(iSlots, i,
+            std::min(end, i + kSamplesPerTask)));
+
+        if (g_readPool)
+        {
+            g_readPool->add(task);
+        }
+        else
+        {
+            task->run();
+        }
+    }
+
+    return end;
+}
+
+// makes sure nothing is still reading into the slots when they go away,
+// such as when writing one of them throws
+class ReadSlotsGuard
+{
+public:
+    ~ReadSlotsGuard()
+    {
+        if (g_readPool)
+        {
+            g_readPool->cancel();
+            try
+            {
+                g_readPool->wait();
+            }
+            catch (...)
+            {
+                // already on the way out because of another error
+            }
+        }
+    }
+};
+
+// the writer for a property the output schema may have already created
+OArrayProperty getArrayWriter(const PropertyHeader & propHeader,
+                              OCompoundProperty & oCompoundProp)
+{
+    const std::string & propName = propHeader.getName();
+    if (oCompoundProp.getPropertyHeader(propName))
+    {
+        return OArrayProperty(
+            oCompoundProp.getPtr()->getProperty(propName)->asArrayPtr(),
+            kWrapExisting);
+    }
+
+    return OArrayProperty(oCompoundProp, propName, propHeader.getDataType(),
+                          propHeader.getMetaData());
+}
+
+OScalarProperty getScalarWriter(const PropertyHeader & propHeader,
+                                OCompoundProperty & oCompoundProp)
+{
+    const std::string & propName = propHeader.getName();
+    if (oCompoundProp.getPropertyHeader(propName))
+    {
+        return OScalarProperty(
+            oCompoundProp.getPtr()->getProperty(propName)->asScalarPtr(),
+            kWrapExisting);
+    }
+
+    return OScalarProperty(oCompoundProp, propName, propHeader.getDataType(),
+                           propHeader.getMetaData());
+}
+
+OCompoundProperty getCompoundWriter(const PropertyHeader & propHeader,
+                                    OCompoundProperty & oCompoundProp)
+{
+    const std::string & propName = propHeader.getName();
+    if (oCompoundProp.getPropertyHeader(propName))
+    {
+        return OCompoundProperty(
+            oCompoundProp.getPtr()->getProperty(propName)->asCompoundPtr(),
+            kWrapExisting);
+    }
+
+    return OCompoundProperty(oCompoundProp, propName,
+                             propHeader.getMetaData());
+}
+
+} // End anonymous namespace
+
+void startReadThreads(size_t iNumThreads)
+{
+    g_readPool.reset(new Alembic::Util::ThreadPool(iNumThreads));
+}
+
+bool usingReadThreads()
+{
+    return g_readPool ? true : false;
+}
+
 index_t getIndexSample(index_t iCurOutIndex, TimeSamplingPtr iOutTime,
     index_t iInNumSamples, TimeSamplingPtr iInTime)
 {
@@ -86,11 +262,15 @@ void stitchArrayProp(const PropertyHeader & propHeader,
                      const ICompoundPropertyVec & iCompoundProps,
                      OCompoundProperty & oCompoundProp)
 {
-    const DataType & dataType = propHeader.getDataType();
-    const MetaData & metaData = propHeader.getMetaData();
     const std::string & propName = propHeader.getName();
 
-    OArrayProperty writer(oCompoundProp, propName, dataType, metaData);
+    OArrayProperty writer = getArrayWriter(propHeader, oCompoundProp);
+
+    // work out up front which sample of which input goes where, so that
+    // all of them can be read before the ones in front have been written
+    ArraySampleSlotVec slots;
+    TimeSamplingPtr outTime = writer.getTimeSampling();
+    index_t numOutSamples = writer.getNumSamples();
 
     size_t numInputs = iCompoundProps.size();
     for (size_t iCpIndex = 0; iCpIndex < numInputs; iCpIndex++)
@@ -98,18 +278,51 @@ void stitchArrayProp(const PropertyHeader & propHeader,
         IArrayProperty reader(iCompoundProps[iCpIndex], propName);
         index_t numSamples = reader.getNumSamples();
 
-        ArraySamplePtr dataPtr;
-        index_t k = getIndexSample(writer.getNumSamples(),
-            writer.getTimeSampling(), numSamples, reader.getTimeSampling());
+        index_t k = getIndexSample(numOutSamples, outTime, numSamples,
+            reader.getTimeSampling());
         for (; k < numSamples; k++)
         {
-            reader.get(dataPtr, k);
-            writer.set(*dataPtr);
+            ArraySampleSlot slot;
+            slot.reader = reader;
+            slot.index = k;
+            slot.hasKey = false;
+            slots.push_back(slot);
+            numOutSamples++;
         }
 
         if (iCpIndex == 0)
         {
             writer.setTimeSampling(reader.getTimeSampling());
+            outTime = reader.getTimeSampling();
+        }
+    }
+
+    // write each window of samples while the next one is being read
+    ReadSlotsGuard guard;
+    size_t readEnd = readSlots(slots, 0);
+    size_t writeBegin = 0;
+    while (writeBegin < slots.size())
+    {
+        if (g_readPool)
+        {
+            g_readPool->wait();
+        }
+
+        size_t writeEnd = readEnd;
+        readEnd = readSlots(slots, writeEnd);
+
+        for (; writeBegin < writeEnd; ++writeBegin)
+        {
+            ArraySampleSlot & slot = slots[writeBegin];
+            if (slot.hasKey)
+            {
+                writer.set(*slot.sample, slot.key);
+            }
+            else
+            {
+                writer.set(*slot.sample);
+            }
+            slot.sample.reset();
         }
     }
 }
@@ -143,10 +356,9 @@ void stitchScalarProp(const PropertyHeader & propHeader,
                       OCompoundProperty & oCompoundProp)
 {
     const DataType & dataType = propHeader.getDataType();
-    const MetaData & metaData = propHeader.getMetaData();
     const std::string & propName = propHeader.getName();
 
-    OScalarProperty writer(oCompoundProp, propName, dataType, metaData);
+    OScalarProperty writer = getScalarWriter(propHeader, oCompoundProp);
 
     size_t numInputs = iCompoundProps.size();
     for (size_t iCpIndex = 0; iCpIndex < numInputs; iCpIndex++)
@@ -209,6 +421,35 @@ void stitchScalarProp(const PropertyHeader & propHeader,
     }
 }
 
+namespace {
+
+void stitchProp(const PropertyHeader & propHeader,
+                ICompoundPropertyVec & iCompoundProps,
+                OCompoundProperty & oCompoundProp)
+{
+    if (propHeader.isCompound())
+    {
+        ICompoundPropertyVec childProps(iCompoundProps.size());
+        for (size_t i = 0; i < childProps.size(); ++i)
+        {
+            childProps[i] = ICompoundProperty(iCompoundProps[i],
+                propHeader.getName());
+        }
+        OCompoundProperty child = getCompoundWriter(propHeader, oCompoundProp);
+        stitchCompoundProp(childProps, child);
+    }
+    else if (propHeader.isScalar())
+    {
+        stitchScalarProp(propHeader, iCompoundProps, oCompoundProp);
+    }
+    else if (propHeader.isArray())
+    {
+        stitchArrayProp(propHeader, iCompoundProps, oCompoundProp);
+    }
+}
+
+} // End anonymous namespace
+
 void stitchCompoundProp(ICompoundPropertyVec & iCompoundProps,
                         OCompoundProperty & oCompoundProp)
 {
@@ -218,26 +459,27 @@ void stitchCompoundProp(ICompoundPropertyVec & iCompoundProps,
         const PropertyHeader & propHeader =
             iCompoundProps[0].getPropertyHeader(propIndex);
 
-        if (propHeader.isCompound())
-        {
-            ICompoundPropertyVec childProps(iCompoundProps.size());
-            for (size_t i = 0; i < childProps.size(); ++i)
-            {
-                childProps[i] = ICompoundProperty(iCompoundProps[i],
-                    propHeader.getName());
-            }
-            OCompoundProperty child(oCompoundProp, propHeader.getName(),
-                propHeader.getMetaData());
-            stitchCompoundProp(childProps, child);
-        }
-        else if (propHeader.isScalar())
-        {
-            stitchScalarProp(propHeader, iCompoundProps, oCompoundProp);
-        }
-        else if (propHeader.isArray())
+        stitchProp(propHeader, iCompoundProps, oCompoundProp);
+    }
+}
+
+void stitchSchemaProps(ICompoundPropertyVec & iSchemaProps,
+                       OCompoundProperty & oSchemaProp)
+{
+    size_t numProps = iSchemaProps[0].getNumProperties();
+    for (size_t propIndex = 0; propIndex < numProps; propIndex++)
+    {
+        const PropertyHeader & propHeader =
+            iSchemaProps[0].getPropertyHeader(propIndex);
+
+        // init has already taken care of these
+        const std::string & propName = propHeader.getName();
+        if (propName == ".arbGeomParams" || propName == ".userProperties" ||
+            propName == ".childBnds")
         {
-            stitchArrayProp(propHeader, iCompoundProps, oCompoundProp);
+            continue;
         }
+
+        stitchProp(propHeader, iSchemaProps, oSchemaProp);
     }
 }
-
@@ -64,5 +64,18 @@ void stitchScalarProp(const Alembic::AbcCoreAbstract::PropertyHeader & propHeade
 void stitchCompoundProp(ICompoundPropertyVec & iCompoundProps,
                         Alembic::Abc::OCompoundProperty & oCompoundProp);
 
+// like stitchCompoundProp, but for the schema compound of a geometry node
+// that init has already set up, so the properties it stitched are skipped
+// and the ones the output schema created up front are written into
+void stitchSchemaProps(ICompoundPropertyVec & iSchemaProps,
+                       Alembic::Abc::OCompoundProperty & oSchemaProp);
+
+// read the samples of the array properties on iNumThreads threads (one per
+// core if it's 0) a window ahead of where they are being written, instead
+// of reading them one at a time on the calling thread
+void startReadThreads(size_t iNumThreads);
+
+bool usingReadThreads();
+
 
 #endif // _ABC_STITCHER_UTIL_H_
@@ -107,7 +107,19 @@ void IPolyMeshDrw::setTime( chrono_t iSeconds )
     }
     else if ( m_polyMesh.getSchema().getNumSamples() > 0 )
     {
-        m_polyMesh.getSchema().get( psamp, ss );
+        // Keep the topology of the last sample when it hasn't changed, so
+        // the helper sees the same indices and keeps its triangles.
+        const IPolyMeshSchema &schema = m_polyMesh.getSchema();
+        if ( m_samp && !schema.isTopologyChanged( m_sampSelector, ss ) )
+        {
+            schema.getDeformed( m_samp, ss );
+        }
+        else
+        {
+            schema.get( m_samp, ss );
+        }
+        m_sampSelector = ss;
+        psamp = m_samp;
     }
 
     // Get the stuff.
@@ -62,6 +62,7 @@ public:
 protected:
     IPolyMesh m_polyMesh;
     IPolyMeshSchema::Sample m_samp;
+    ISampleSelector m_sampSelector;
     IBox3dProperty m_boundsProp;
     MeshDrwHelper m_drwHelper;
 };
@@ -107,7 +107,19 @@ void ISubDDrw::setTime( chrono_t iSeconds )
     }
     else if ( m_subD.getSchema().getNumSamples() > 0 )
     {
-        m_subD.getSchema().get( psamp, ss );
+        // Keep the topology of the last sample when it hasn't changed, so
+        // the helper sees the same indices and keeps its triangles.
+        const ISubDSchema &schema = m_subD.getSchema();
+        if ( m_samp && !schema.isTopologyChanged( m_sampSelector, ss ) )
+        {
+            schema.getDeformed( m_samp, ss );
+        }
+        else
+        {
+            schema.get( m_samp, ss );
+        }
+        m_sampSelector = ss;
+        psamp = m_samp;
     }
 
     // Get the stuff.
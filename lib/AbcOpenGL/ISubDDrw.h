@@ -62,6 +62,7 @@ public:
 protected:
     ISubD m_subD;
     ISubDSchema::Sample m_samp;
+    ISampleSelector m_sampSelector;
     IBox3dProperty m_boundsProp;
     MeshDrwHelper m_drwHelper;
 };
@@ -48,6 +48,7 @@
 #include <Alembic/Abc/IBaseProperty.h>
 #include <Alembic/Abc/ICompoundProperty.h>
 #include <Alembic/Abc/IObject.h>
+#include <Alembic/Abc/ISamplePrefetcher.h>
 #include <Alembic/Abc/ISampleSelector.h>
 #include <Alembic/Abc/IScalarProperty.h>
 #include <Alembic/Abc/ISchema.h>
@@ -75,6 +75,48 @@ IObject IArchive::getTop()
     return IObject();
 }
 
+//-*****************************************************************************
+IObject IArchive::findObject( const std::string &iFullName )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::findObject()" );
+
+    AbcA::ObjectReaderPtr obj = m_archive->findObject( iFullName );
+    if ( obj )
+    {
+        return IObject( obj, kWrapExisting, getErrorHandlerPolicy() );
+    }
+
+    // instances aren't in the file under their instanced names, so walk
+    // down so that IObject can follow them
+    IObject cur( m_archive->getTop(), kWrapExisting, getErrorHandlerPolicy() );
+    std::size_t start = 0;
+    while ( cur.valid() && start < iFullName.size() )
+    {
+        std::size_t end = iFullName.find( '/', start );
+        if ( end == std::string::npos )
+        {
+            end = iFullName.size();
+        }
+
+        if ( end > start )
+        {
+            cur = cur.getChild( iFullName.substr( start, end - start ) );
+        }
+
+        start = end + 1;
+    }
+
+    if ( cur.valid() )
+    {
+        return cur;
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // Not all error handlers throw, so here is a default behavior.
+    return IObject();
+}
+
 //-*****************************************************************************
 AbcA::ReadArraySampleCachePtr IArchive::getReadArraySampleCachePtr()
 {
@@ -142,6 +184,70 @@ int32_t IArchive::getArchiveVersion( )
     return 0;
 }
 
+//-*****************************************************************************
+size_t IArchive::getNumIndexedObjects()
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::getNumIndexedObjects" );
+
+    return m_archive->getNumIndexedObjects();
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // Not all error handlers throw, so here is a default behavior.
+    return 0;
+}
+
+//-*****************************************************************************
+const AbcA::ObjectHeader & IArchive::getIndexedObjectHeader( size_t i )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::getIndexedObjectHeader()" );
+
+    return m_archive->getIndexedObjectHeader( i );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // Not all error handlers throw, have a default.
+    static const AbcA::ObjectHeader hd;
+    return hd;
+}
+
+//-*****************************************************************************
+const AbcA::ObjectHeader *
+IArchive::getIndexedObjectHeader( const std::string &iFullName )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::getIndexedObjectHeader( name )" );
+
+    return m_archive->getIndexedObjectHeader( iFullName );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // Not all error handlers throw, so here is a default behavior.
+    return NULL;
+}
+
+//-*****************************************************************************
+AbcA::ReadStats IArchive::getReadStats()
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::getReadStats" );
+
+    return m_archive->getReadStats();
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // Not all error handlers throw, so here is a default behavior.
+    return AbcA::ReadStats();
+}
+
+//-*****************************************************************************
+void IArchive::resetReadStats()
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::resetReadStats" );
+
+    m_archive->resetReadStats();
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 void IArchive::setReadArraySampleCachePtr( AbcA::ReadArraySampleCachePtr iPtr )
 {
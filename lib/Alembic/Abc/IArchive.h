@@ -121,6 +121,13 @@ public:
     //! automatically as part of the archive.
     IObject getTop();
 
+    //! Returns the object with the given full name, like "/a/b/c", or an
+    //! invalid IObject if there isn't one.  Archives which support it find
+    //! the object without opening the ones above it, which is much cheaper
+    //! than walking down to it when only the one object is needed.
+    //! Paths which go through an instance are walked.
+    IObject findObject( const std::string &iFullName );
+
     //! Get the read array sample cache. It may be a NULL pointer.
     //! Caches can be shared amongst separate archives, and caching
     //! will is disabled if a NULL cache is returned here.
@@ -129,6 +136,8 @@ public:
     //! Set the read array sample cache. It may also be a NULL pointer.
     //! Caches can be shared amongst separate archives, and caching
     //! will be disabled if a NULL cache is passed here.
+    //! Don't call this while other threads are reading from the archive,
+    //! pass the cache in when the archive is opened instead.
     void setReadArraySampleCachePtr( AbcA::ReadArraySampleCachePtr iPtr );
 
     //-*************************************************************************
@@ -170,6 +179,29 @@ public:
     //! of this archive file.
     int32_t getArchiveVersion();
 
+    //! Returns how many objects are in the archive's object index, or 0 if
+    //! it wasn't written with one (see AbcCoreOgawa::WriteArchive).
+    size_t getNumIndexedObjects();
+
+    //! Returns the header of the i'th object in the object index, parents
+    //! come before their children.  Handy for finding every object of a
+    //! given schema without walking the hierarchy.
+    const AbcA::ObjectHeader & getIndexedObjectHeader( size_t i );
+
+    //! Returns the header of the object with the given full name from the
+    //! object index, or NULL if it isn't in the index.
+    const AbcA::ObjectHeader *
+    getIndexedObjectHeader( const std::string &iFullName );
+
+    //! Returns how much has been read from the archive, and what was made
+    //! from it.  Only counted if the archive was opened asking for it (see
+    //! AbcCoreFactory::IFactory::setReadStats), otherwise it is all 0.
+    AbcA::ReadStats getReadStats();
+
+    //! Sets the read counts back to 0, for measuring just the reads that
+    //! follow.
+    void resetReadStats();
+
     //! The unspecified-bool-type operator casts the object to "true"
     //! if it is valid, and "false" otherwise.
     ALEMBIC_OPERATOR_BOOL( valid() );
@@ -144,6 +144,48 @@ void IArrayProperty::getAs( void * oSample,
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+void IArrayProperty::get( std::vector< AbcA::ArraySamplePtr > & oSamples,
+                          const std::vector< ISampleSelector > & iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArrayProperty::get(vector)" );
+
+    AbcA::TimeSamplingPtr ts = m_property->getTimeSampling();
+    size_t numSamples = m_property->getNumSamples();
+
+    std::vector< index_t > indices( iSS.size() );
+    for ( size_t i = 0; i < iSS.size(); ++i )
+    {
+        indices[i] = iSS[i].getIndex( ts, numSamples );
+    }
+
+    m_property->getSamples( indices, oSamples );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void IArrayProperty::getAs( void * oSamples,
+                            AbcA::PlainOldDataType iPod,
+                            const std::vector< ISampleSelector > & iSS )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN(
+        "IArrayProperty::getAs(PlainOldDataType, vector)" );
+
+    AbcA::TimeSamplingPtr ts = m_property->getTimeSampling();
+    size_t numSamples = m_property->getNumSamples();
+
+    std::vector< index_t > indices( iSS.size() );
+    for ( size_t i = 0; i < iSS.size(); ++i )
+    {
+        indices[i] = iSS[i].getIndex( ts, numSamples );
+    }
+
+    m_property->getSamplesAs( indices, oSamples, iPod );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 bool IArrayProperty::getKey( AbcA::ArraySampleKey& oKey,
                              const ISampleSelector &iSS ) const
@@ -161,6 +203,43 @@ bool IArrayProperty::getKey( AbcA::ArraySampleKey& oKey,
     return false;
 }
 
+//-*****************************************************************************
+bool IArrayProperty::isSameSample( const ISampleSelector &iSS0,
+                                   const ISampleSelector &iSS1 ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArrayProperty::isSameSample()" );
+
+    AbcA::TimeSamplingPtr ts = m_property->getTimeSampling();
+    size_t numSamples = m_property->getNumSamples();
+
+    index_t index0 = iSS0.getIndex( ts, numSamples );
+    index_t index1 = iSS1.getIndex( ts, numSamples );
+
+    if ( index0 == index1 || m_property->isConstant() )
+    {
+        return true;
+    }
+
+    AbcA::ArraySampleKey key0;
+    AbcA::ArraySampleKey key1;
+    if ( m_property->getKey( index0, key0 ) &&
+         m_property->getKey( index1, key1 ) )
+    {
+        return key0 == key1;
+    }
+
+    AbcA::ArraySamplePtr samp0;
+    AbcA::ArraySamplePtr samp1;
+    m_property->getSample( index0, samp0 );
+    m_property->getSample( index1, samp1 );
+    return samp0->getKey() == samp1->getKey();
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // for error handler that don't throw
+    return false;
+}
+
 //-*****************************************************************************
 void IArrayProperty::getDimensions( Util::Dimensions & oDim,
                                     const ISampleSelector &iSS ) const
@@ -138,11 +138,28 @@ public:
     void getAs( void *oSample,
                 const ISampleSelector &iSS = ISampleSelector() );
 
+    //! Get several samples in one call, oSamples ends up with one sample
+    //! for each of the sample selectors.
+    void get( std::vector< AbcA::ArraySamplePtr > & oSamples,
+              const std::vector< ISampleSelector > & iSS ) const;
+
+    //! Get several samples, one after the other, into the address of a
+    //! datum as a particular POD type.  The datum is laid out as
+    //! [sample][element] and must be big enough to hold all of them.
+    void getAs( void *oSamples, AbcA::PlainOldDataType iPod,
+                const std::vector< ISampleSelector > & iSS );
+
     //! Get a key from an address of a datum.
     //! ...
     bool getKey( AbcA::ArraySampleKey& oKey,
                  const ISampleSelector &iSS = ISampleSelector() ) const;
 
+    //! Ask if the samples at iSS0 and iSS1 hold the same data.  This compares
+    //! the keys stored with the samples, so neither sample gets read unless
+    //! the archive doesn't store keys.
+    bool isSameSample( const ISampleSelector &iSS0,
+                       const ISampleSelector &iSS1 ) const;
+
     //! Get the dimensions of the datum.
     void getDimensions( Util::Dimensions & oDim,
                         const ISampleSelector &iSS = ISampleSelector() ) const;
@@ -0,0 +1,218 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+
+#include <Alembic/Abc/ISamplePrefetcher.h>
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+// how many properties each task reads
+const std::size_t PROPERTIES_PER_TASK = 16;
+
+//-*****************************************************************************
+class PrefetchTask : public Util::Task
+{
+public:
+    PrefetchTask( chrono_t iStartTime, chrono_t iEndTime )
+        : m_startTime( iStartTime ), m_endTime( iEndTime ) {}
+
+    void add( AbcA::ArrayPropertyReaderPtr iProp )
+    {
+        m_properties.push_back( iProp );
+    }
+
+    std::size_t size() const { return m_properties.size(); }
+
+    virtual void run()
+    {
+        if ( m_properties.empty() )
+        {
+            return;
+        }
+
+        // every property comes from the same archive, read them all through
+        // one stream
+        AbcA::ReadStreamBindingPtr binding =
+            m_properties[0]->getObject()->getArchive()->bindReadStream();
+
+        for ( std::size_t i = 0; i < m_properties.size(); ++i )
+        {
+            AbcA::ArrayPropertyReaderPtr prop = m_properties[i];
+            std::size_t numSamples = prop->getNumSamples();
+            if ( numSamples == 0 )
+            {
+                continue;
+            }
+
+            AbcA::TimeSamplingPtr ts = prop->getTimeSampling();
+            index_t first = ts->getFloorIndex( m_startTime, numSamples ).first;
+            index_t last = ts->getCeilIndex( m_endTime, numSamples ).first;
+
+            // reading them is all it takes to get them into the cache
+            AbcA::ArraySamplePtr samp;
+            for ( index_t j = first; j <= last; ++j )
+            {
+                prop->getSample( j, samp );
+            }
+        }
+    }
+
+private:
+    chrono_t m_startTime;
+    chrono_t m_endTime;
+    std::vector< AbcA::ArrayPropertyReaderPtr > m_properties;
+};
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+ISamplePrefetcher::ISamplePrefetcher( IArchive & iArchive,
+                                      const std::vector< IObject > & iObjects,
+                                      std::size_t iNumThreads )
+    : m_archive( iArchive )
+    , m_concurrent( iArchive.valid() &&
+                    iArchive.getPtr()->supportsConcurrentReads() )
+    , m_pool( m_concurrent ? iNumThreads : 1 )
+{
+    ABCA_ASSERT( m_archive.valid(), "Invalid archive given to prefetch" );
+
+    // other threads may already be reading the archive, so its cache isn't
+    // set here
+    m_cache = m_archive.getReadArraySampleCachePtr();
+    ABCA_ASSERT( m_cache, "Archive given to prefetch has no sample cache: "
+                 << m_archive.getName() );
+
+    if ( iObjects.empty() )
+    {
+        addObject( m_archive.getTop().getPtr() );
+    }
+
+    for ( std::size_t i = 0; i < iObjects.size(); ++i )
+    {
+        addObject( iObjects[i].getPtr() );
+    }
+}
+
+//-*****************************************************************************
+ISamplePrefetcher::~ISamplePrefetcher()
+{
+    m_pool.cancel();
+}
+
+//-*****************************************************************************
+void ISamplePrefetcher::prefetch( chrono_t iStartTime, chrono_t iEndTime )
+{
+    m_pool.cancel();
+
+    // neither the archive nor its cache can be read from the pool
+    if ( !m_concurrent )
+    {
+        return;
+    }
+
+    Alembic::Util::shared_ptr< PrefetchTask > task;
+    for ( std::size_t i = 0; i < m_properties.size(); ++i )
+    {
+        if ( !task )
+        {
+            task.reset( new PrefetchTask( iStartTime, iEndTime ) );
+        }
+
+        task->add( m_properties[i] );
+
+        if ( task->size() == PROPERTIES_PER_TASK )
+        {
+            m_pool.add( task );
+            task.reset();
+        }
+    }
+
+    m_pool.add( task );
+}
+
+//-*****************************************************************************
+void ISamplePrefetcher::wait()
+{
+    m_pool.wait();
+}
+
+//-*****************************************************************************
+void ISamplePrefetcher::cancel()
+{
+    m_pool.cancel();
+}
+
+//-*****************************************************************************
+void ISamplePrefetcher::addProperties( AbcA::CompoundPropertyReaderPtr iProp )
+{
+    for ( std::size_t i = 0; i < iProp->getNumProperties(); ++i )
+    {
+        const AbcA::PropertyHeader & header = iProp->getPropertyHeader( i );
+        if ( header.isArray() )
+        {
+            m_properties.push_back(
+                iProp->getArrayProperty( header.getName() ) );
+        }
+        else if ( header.isCompound() )
+        {
+            addProperties( iProp->getCompoundProperty( header.getName() ) );
+        }
+    }
+}
+
+//-*****************************************************************************
+void ISamplePrefetcher::addObject( AbcA::ObjectReaderPtr iObj )
+{
+    if ( !iObj )
+    {
+        return;
+    }
+
+    addProperties( iObj->getProperties() );
+
+    for ( std::size_t i = 0; i < iObj->getNumChildren(); ++i )
+    {
+        addObject( iObj->getChild( i ) );
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace Abc
+} // End namespace Alembic
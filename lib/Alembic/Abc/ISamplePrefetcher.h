@@ -0,0 +1,114 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+
+#ifndef _Alembic_Abc_ISamplePrefetcher_h_
+#define _Alembic_Abc_ISamplePrefetcher_h_
+
+#include <Alembic/Abc/Foundation.h>
+#include <Alembic/Abc/IArchive.h>
+#include <Alembic/Abc/IObject.h>
+#include <Alembic/Util/ThreadPool.h>
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! Reads array samples ahead of time on background threads so that they are
+//! already sitting in the archive's ReadArraySampleCache when they are asked
+//! for, which keeps playback from stalling on the disk.
+//! The array properties of the requested objects (and everything below them)
+//! are found once, up front, so the hierarchy isn't walked from more than
+//! one thread.  Archives which can't be read from several threads at once,
+//! like HDF5 ones, aren't read ahead at all.
+class ISamplePrefetcher : Alembic::Util::noncopyable
+{
+public:
+    //! Prefetches for every object under iObjects, or for the whole archive
+    //! if iObjects is empty.  iNumThreads of 0 uses one thread per core.
+    //! The archive has to have been opened with a thread safe
+    //! ReadArraySampleCache, like an LRUReadArraySampleCache, since the
+    //! cache can't be swapped while the archive is being read.
+    ISamplePrefetcher( IArchive & iArchive,
+                       const std::vector< IObject > & iObjects =
+                           std::vector< IObject >(),
+                       std::size_t iNumThreads = 0 );
+
+    //! Drops whatever hasn't been read yet, and waits for the rest.
+    ~ISamplePrefetcher();
+
+    //! Starts reading every array sample needed between iStartTime and
+    //! iEndTime, including the samples just before and after them for
+    //! interpolation.  Anything from an earlier call which hasn't been read
+    //! yet is dropped, so this can be called every time the current time
+    //! changes.  Does nothing if the archive doesn't support concurrent
+    //! reads.
+    void prefetch( chrono_t iStartTime, chrono_t iEndTime );
+
+    //! Waits for everything requested by prefetch to be read.
+    void wait();
+
+    //! Drops whatever hasn't been read yet.
+    void cancel();
+
+    //! The cache the samples are read into.
+    AbcA::ReadArraySampleCachePtr getCache() { return m_cache; }
+
+    //! The number of array properties being prefetched.
+    std::size_t getNumProperties() const { return m_properties.size(); }
+
+private:
+    void addProperties( AbcA::CompoundPropertyReaderPtr iProp );
+    void addObject( AbcA::ObjectReaderPtr iObj );
+
+    IArchive m_archive;
+    AbcA::ReadArraySampleCachePtr m_cache;
+    std::vector< AbcA::ArrayPropertyReaderPtr > m_properties;
+
+    // whether the archive can be read from the pool's threads
+    bool m_concurrent;
+    Util::ThreadPool m_pool;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Abc
+} // End namespace Alembic
+
+#endif
@@ -143,6 +143,21 @@ public:
                                                   AbcA::ArraySample>( ptr );
     }
 
+    //! Get several typed samples in one call, one for each of the
+    //! sample selectors.
+    void get( std::vector< sample_ptr_type > & oVals,
+              const std::vector< ISampleSelector > & iSS ) const
+    {
+        std::vector< AbcA::ArraySamplePtr > ptrs;
+        IArrayProperty::get( ptrs, iSS );
+        oVals.resize( ptrs.size() );
+        for ( size_t i = 0; i < ptrs.size(); ++i )
+        {
+            oVals[i] = Alembic::Util::static_pointer_cast<sample_type,
+                AbcA::ArraySample>( ptrs[i] );
+        }
+    }
+
     //! Return the typed sample by value.
     //! ...
     sample_ptr_type getValue( const ISampleSelector &iSS = ISampleSelector() ) const
@@ -131,6 +131,8 @@ public:
     //! Set the compression applied to array properties.
     //! Value of -1 means uncompressed, and values of 0-9 indicate increasingly
     //! compressed data, at the expense of time.
+    //! Ogawa archives compress the array properties created after this is
+    //! set, and older Alembic libraries will refuse to read them.
     void setCompressionHint( int8_t iCh );
 
     //! Adds the TimeSampling to the Archive TimeSampling pool.
@@ -69,6 +69,17 @@ void OArrayProperty::set( const AbcA::ArraySample &iSamp )
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+void OArrayProperty::set( const AbcA::ArraySample &iSamp,
+                          const AbcA::ArraySample::Key &iKey )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "OArrayProperty::set()" );
+
+    m_property->setSample( iSamp, iKey );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 void OArrayProperty::setFromPrevious()
 {
@@ -42,6 +42,9 @@
 #include <Alembic/Abc/OBaseProperty.h>
 #include <Alembic/Abc/OCompoundProperty.h>
 
+#include <sstream>
+#include <stdlib.h>
+
 namespace Alembic {
 namespace Abc {
 namespace ALEMBIC_VERSION_NS {
@@ -117,6 +120,12 @@ public:
     //! ...
     void set( const AbcA::ArraySample &iSample );
 
+    //! Set a sample whose key is already known, such as one read from
+    //! another archive along with IArrayProperty::getKey, which saves
+    //! hashing the sample again.
+    void set( const AbcA::ArraySample &iSample,
+              const AbcA::ArraySample::Key &iKey );
+
     //! Set a sample from the previous sample.
     //! ...
     void setFromPrevious( );
@@ -149,6 +158,34 @@ private:
                const Argument &iArg2 );
 };
 
+//-*****************************************************************************
+//! These functions set or get, on the MetaData of an array property, how
+//! many samples there can be between two samples which are written whole.
+//! The samples in between are written as just the points which changed
+//! since the previous sample, which suits deformations where most points
+//! stay put, and reading one means reading the ones before it back to the
+//! last whole sample.  0, the default, writes every sample whole.
+//! Only the Ogawa backend writes these, archives with them can't be read
+//! by libraries older than that.
+//-*****************************************************************************
+
+//-*****************************************************************************
+inline void SetDeltaInterval( AbcA::MetaData &ioMetaData,
+                              Alembic::Util::uint32_t iInterval )
+{
+    std::ostringstream strm;
+    strm << iInterval;
+    ioMetaData.set( "deltaInterval", strm.str() );
+}
+
+//-*****************************************************************************
+inline Alembic::Util::uint32_t
+GetDeltaInterval( const AbcA::MetaData &iMetaData )
+{
+    return ( Alembic::Util::uint32_t )
+        atoi( iMetaData.get( "deltaInterval" ).c_str() );
+}
+
 //-*****************************************************************************
 // TEMPLATE AND INLINE FUNCTIONS
 //-*****************************************************************************
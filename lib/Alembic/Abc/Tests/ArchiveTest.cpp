@@ -162,11 +162,102 @@ void scopingTest(bool useOgawa)
     }
 }
 
+void writePoolArchive(std::size_t numChildren)
+{
+    OArchive archive(Alembic::AbcCoreOgawa::WriteArchive(),
+                     "archivePool.abc");
+    for (std::size_t i = 0; i < numChildren; ++i)
+    {
+        std::ostringstream name;
+        name << "child" << i;
+        OObject child(archive.getTop(), name.str());
+    }
+}
+
+void archivePoolTest()
+{
+    writePoolArchive(1);
+
+    AbcF::ArchivePoolPtr pool(new AbcF::ArchivePool(2));
+    AbcF::IFactory factory;
+    factory.setArchivePool(pool);
+    TESTING_ASSERT(factory.getArchivePool() == pool);
+
+    {
+        AbcF::IFactory::CoreType coreType;
+        IArchive a = factory.getArchive("archivePool.abc", coreType);
+        TESTING_ASSERT(coreType == AbcF::IFactory::kOgawa);
+        IArchive b = factory.getArchive("archivePool.abc", coreType);
+        TESTING_ASSERT(coreType == AbcF::IFactory::kOgawa);
+        TESTING_ASSERT(a.getPtr() == b.getPtr());
+        TESTING_ASSERT(pool->getNumHits() == 1);
+        TESTING_ASSERT(pool->getNumMisses() == 1);
+
+        // different options are a different archive
+        AbcF::IFactory streamsFactory(factory);
+        streamsFactory.setOgawaNumStreams(2);
+        IArchive c = streamsFactory.getArchive("archivePool.abc");
+        TESTING_ASSERT(c.valid() && c.getPtr() != a.getPtr());
+        TESTING_ASSERT(pool->getNumArchives() == 2);
+        TESTING_ASSERT(pool->getNumIdleArchives() == 0);
+
+        // holding onto an object holds onto the archive
+        IObject child = a.getTop().getChild(0);
+        a = IArchive();
+        b = IArchive();
+        TESTING_ASSERT(pool->getNumIdleArchives() == 0);
+        TESTING_ASSERT(factory.getArchive(
+            "archivePool.abc").getPtr() == child.getArchive().getPtr());
+    }
+
+    // only the most recently used idle archive is kept
+    TESTING_ASSERT(pool->getNumArchives() == 2);
+    TESTING_ASSERT(pool->getNumIdleArchives() == 2);
+    TESTING_ASSERT(factory.getArchive("archivePool.abc").valid());
+    TESTING_ASSERT(pool->getNumArchives() == 2);
+    pool->setMaxIdle(1);
+    TESTING_ASSERT(pool->getNumArchives() == 1);
+    TESTING_ASSERT(factory.getArchive("archivePool.abc").valid());
+    TESTING_ASSERT(pool->getNumHits() == 4);
+    TESTING_ASSERT(pool->getNumMisses() == 2);
+
+    {
+        IArchive old = factory.getArchive("archivePool.abc");
+        TESTING_ASSERT(old.getTop().getNumChildren() == 1);
+
+        // a changed file is opened again, the old archive is left alone
+        writePoolArchive(3);
+        IArchive changed = factory.getArchive("archivePool.abc");
+        TESTING_ASSERT(changed.getPtr() != old.getPtr());
+        TESTING_ASSERT(changed.getTop().getNumChildren() == 3);
+        TESTING_ASSERT(old.getTop().getNumChildren() == 1);
+        TESTING_ASSERT(pool->getNumArchives() == 1);
+
+        pool->erase("archivePool.abc");
+        TESTING_ASSERT(pool->getNumArchives() == 0);
+        TESTING_ASSERT(factory.getArchive(
+            "archivePool.abc").getPtr() != changed.getPtr());
+    }
+
+    pool->setMaxIdle(0);
+    TESTING_ASSERT(pool->getNumArchives() == 0);
+
+    // files which can't be opened aren't pooled
+    factory.setPolicy(ErrorHandler::kQuietNoopPolicy);
+    TESTING_ASSERT(!factory.getArchive("archivePoolMissing.abc").valid());
+    TESTING_ASSERT(pool->getNumArchives() == 0);
+
+    TESTING_ASSERT(AbcF::ArchivePool::getShared());
+    TESTING_ASSERT(AbcF::ArchivePool::getShared() ==
+                   AbcF::ArchivePool::getShared());
+}
+
 int main( int argc, char *argv[] )
 {
     archiveInfoTest(false);
     archiveInfoTest(true);
     scopingTest(false);
     scopingTest(true);
+    archivePoolTest();
     return 0;
 }
@@ -36,6 +36,8 @@
 
 #include <Alembic/Abc/All.h>
 #include <Alembic/AbcCoreHDF5/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
 #include <iostream>
 
 namespace Abc = Alembic::Abc;
@@ -103,9 +105,204 @@ void cacheControlTest( const std::string &iArchiveBaseName )
     }
 }
 
+//-*****************************************************************************
+// Ogawa shares identical array samples through the cache, even across archives
+void ogawaCacheTest()
+{
+    std::string archiveName = "ogawaCache.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+                          archiveName );
+        OObject topobj = archive.getTop();
+
+        std::vector< Alembic::Util::int32_t > vals( 20, 7 );
+        for ( size_t i = 0 ; i < 2 ; i++ )
+        {
+            OObject child( topobj, i == 0 ? "a" : "b" );
+            OInt32ArrayProperty prop( child.getProperties(), "vals" );
+            prop.set( vals );
+        }
+    }
+
+    ReadArraySampleCachePtr cache = Alembic::AbcCoreHDF5::CreateCache();
+    IArchive archive1( Alembic::AbcCoreOgawa::ReadArchive(), archiveName,
+                       ErrorHandler::kThrowPolicy, cache );
+    IArchive archive2( Alembic::AbcCoreOgawa::ReadArchive(), archiveName,
+                       ErrorHandler::kThrowPolicy, cache );
+    TESTING_ASSERT( archive1.getReadArraySampleCachePtr() == cache );
+
+    Int32ArraySamplePtr sampA;
+    IInt32ArrayProperty( IObject( archive1.getTop(), "a" ).getProperties(),
+                         "vals" ).get( sampA );
+
+    Int32ArraySamplePtr sampB;
+    IInt32ArrayProperty( IObject( archive1.getTop(), "b" ).getProperties(),
+                         "vals" ).get( sampB );
+
+    Int32ArraySamplePtr sampOther;
+    IInt32ArrayProperty( IObject( archive2.getTop(), "a" ).getProperties(),
+                         "vals" ).get( sampOther );
+
+    TESTING_ASSERT( sampA->size() == 20 && ( *sampA )[19] == 7 );
+    TESTING_ASSERT( sampA->getData() == sampB->getData() );
+    TESTING_ASSERT( sampA->getData() == sampOther->getData() );
+
+    // without a cache each read gets its own sample
+    IArchive archive3( Alembic::AbcCoreOgawa::ReadArchive(), archiveName,
+                       ErrorHandler::kThrowPolicy, ReadArraySampleCachePtr() );
+    TESTING_ASSERT( !archive3.getReadArraySampleCachePtr() );
+
+    Int32ArraySamplePtr samp1;
+    IInt32ArrayProperty( IObject( archive3.getTop(), "a" ).getProperties(),
+                         "vals" ).get( samp1 );
+
+    Int32ArraySamplePtr samp2;
+    IInt32ArrayProperty( IObject( archive3.getTop(), "b" ).getProperties(),
+                         "vals" ).get( samp2 );
+
+    TESTING_ASSERT( samp1->getData() != samp2->getData() );
+    TESTING_ASSERT( ( *samp2 )[0] == 7 );
+}
+
+//-*****************************************************************************
+// Samples with the same bytes but a different shape aren't shared
+void ogawaCacheShapeTest()
+{
+    std::string archiveName = "ogawaCacheShape.abc";
+    std::vector< Alembic::Util::float32_t > floats( 30 );
+    for ( size_t i = 0; i < floats.size(); ++i )
+    {
+        floats[i] = float( i );
+    }
+
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+                          archiveName );
+        OCompoundProperty props = archive.getTop().getProperties();
+        OV3fArrayProperty( props, "points" ).set( V3fArraySample(
+            ( const V3f * ) &floats.front(), floats.size() / 3 ) );
+        OFloatArrayProperty( props, "floats" ).set( floats );
+    }
+
+    ReadArraySampleCachePtr cache = Alembic::AbcCoreHDF5::CreateCache();
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), archiveName,
+                      ErrorHandler::kThrowPolicy, cache );
+    ICompoundProperty props = archive.getTop().getProperties();
+
+    V3fArraySamplePtr points;
+    IV3fArrayProperty( props, "points" ).get( points );
+
+    FloatArraySamplePtr floatSamp;
+    IFloatArrayProperty( props, "floats" ).get( floatSamp );
+
+    TESTING_ASSERT( points->size() == 10 );
+    TESTING_ASSERT( points->getDataType().getExtent() == 3 );
+    TESTING_ASSERT( ( *points )[9] == V3f( 27.0f, 28.0f, 29.0f ) );
+    TESTING_ASSERT( floatSamp->size() == 30 );
+    TESTING_ASSERT( floatSamp->getDataType().getExtent() == 1 );
+    TESTING_ASSERT( ( *floatSamp )[29] == 29.0f );
+}
+
+//-*****************************************************************************
+// Samples read ahead by the prefetcher end up in the cache
+void prefetchTest()
+{
+    std::string archiveName = "prefetch.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+                          archiveName );
+        OObject child( archive.getTop(), "a" );
+        OInt32ArrayProperty prop( child.getProperties(), "vals" );
+        for ( Alembic::Util::int32_t i = 0 ; i < 10 ; i++ )
+        {
+            std::vector< Alembic::Util::int32_t > vals( 20, i );
+            prop.set( vals );
+        }
+    }
+
+    // the archive needs a cache to prefetch into
+    {
+        IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), archiveName,
+                          ErrorHandler::kThrowPolicy,
+                          ReadArraySampleCachePtr() );
+        bool caught = false;
+        try
+        {
+            ISamplePrefetcher prefetcher( archive );
+        }
+        catch ( std::exception & )
+        {
+            caught = true;
+        }
+        TESTING_ASSERT( caught );
+    }
+
+    Alembic::AbcCoreAbstract::LRUReadArraySampleCachePtr cache(
+        new Alembic::AbcCoreAbstract::LRUReadArraySampleCache( 1048576 ) );
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), archiveName,
+                      ErrorHandler::kThrowPolicy, cache );
+
+    ISamplePrefetcher prefetcher( archive, std::vector< IObject >(), 2 );
+    TESTING_ASSERT( prefetcher.getNumProperties() == 1 );
+    TESTING_ASSERT( prefetcher.getCache() == cache );
+
+    // the default time sampling is one sample per second
+    prefetcher.prefetch( 2.0, 4.0 );
+    prefetcher.wait();
+    TESTING_ASSERT( cache->getNumSamples() == 3 );
+
+    Alembic::Util::uint64_t hits = cache->getNumHits();
+    Int32ArraySamplePtr samp;
+    IInt32ArrayProperty( IObject( archive.getTop(), "a" ).getProperties(),
+                         "vals" ).get( samp, ISampleSelector( 3.0 ) );
+    TESTING_ASSERT( samp->size() == 20 && ( *samp )[0] == 3 );
+    TESTING_ASSERT( cache->getNumHits() == hits + 1 );
+}
+
+//-*****************************************************************************
+// HDF5 archives can't be read from the prefetcher's threads, so nothing is
+// read ahead
+void prefetchHDF5Test()
+{
+    std::string archiveName = "prefetchHDF5.abc";
+    {
+        OArchive archive( Alembic::AbcCoreHDF5::WriteArchive(),
+                          archiveName );
+        OObject child( archive.getTop(), "a" );
+        OInt32ArrayProperty prop( child.getProperties(), "vals" );
+        for ( Alembic::Util::int32_t i = 0 ; i < 10 ; i++ )
+        {
+            std::vector< Alembic::Util::int32_t > vals( 20, i );
+            prop.set( vals );
+        }
+    }
+
+    Alembic::AbcCoreAbstract::LRUReadArraySampleCachePtr cache(
+        new Alembic::AbcCoreAbstract::LRUReadArraySampleCache( 1048576 ) );
+    IArchive archive( Alembic::AbcCoreHDF5::ReadArchive(), archiveName,
+                      ErrorHandler::kThrowPolicy, cache );
+    TESTING_ASSERT( !archive.getPtr()->supportsConcurrentReads() );
+
+    ISamplePrefetcher prefetcher( archive, std::vector< IObject >(), 2 );
+    TESTING_ASSERT( prefetcher.getNumProperties() == 1 );
+
+    prefetcher.prefetch( 2.0, 4.0 );
+    prefetcher.wait();
+    TESTING_ASSERT( cache->getNumSamples() == 0 );
+
+    Int32ArraySamplePtr samp;
+    IInt32ArrayProperty( IObject( archive.getTop(), "a" ).getProperties(),
+                         "vals" ).get( samp, ISampleSelector( 3.0 ) );
+    TESTING_ASSERT( samp->size() == 20 && ( *samp )[0] == 3 );
+}
+
 //-*****************************************************************************
 int main( int argc, char *argv[] )
 {
     cacheControlTest( "oooooooh_ca-aache_controoo-ool_oooh_oh" );
+    ogawaCacheTest();
+    ogawaCacheShapeTest();
+    prefetchTest();
+    prefetchHDF5Test();
     return 0;
 }
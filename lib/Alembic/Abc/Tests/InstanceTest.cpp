@@ -228,6 +228,21 @@ void simpleTestIn( const std::string& iArchiveName )
     IObject x2aParent = x2a.getParent();
     TESTING_ASSERT( x2aParent.getFullName() == "/x1" );
     TESTING_ASSERT( !x2aParent.isInstanceDescendant() );
+
+    // find objects by their full name, including through an instance
+    IObject found = archive.findObject( "/x1/x2/x4/g2/g5" );
+    TESTING_ASSERT( found.valid() );
+    TESTING_ASSERT( found.getFullName() == g5.getFullName() );
+    TESTING_ASSERT( found.getParent().getFullName() == g2.getFullName() );
+    TESTING_ASSERT( !found.isInstanceDescendant() );
+
+    found = archive.findObject( "/x1/x3/x5/g2/g5" );
+    TESTING_ASSERT( found.valid() );
+    TESTING_ASSERT( found.isInstanceDescendant() );
+    TESTING_ASSERT( found.getFullName() == g5p.getFullName() );
+
+    TESTING_ASSERT( !archive.findObject( "/x1/x3/x6" ).valid() );
+    TESTING_ASSERT( archive.findObject( "/" ).getFullName() == "/" );
 }
 
 //-*****************************************************************************
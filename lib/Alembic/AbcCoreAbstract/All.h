@@ -50,11 +50,13 @@
 #include <Alembic/AbcCoreAbstract/DataType.h>
 #include <Alembic/AbcCoreAbstract/ForwardDeclarations.h>
 #include <Alembic/AbcCoreAbstract/Foundation.h>
+#include <Alembic/AbcCoreAbstract/LRUReadArraySampleCache.h>
 #include <Alembic/AbcCoreAbstract/MetaData.h>
 #include <Alembic/AbcCoreAbstract/ObjectHeader.h>
 #include <Alembic/AbcCoreAbstract/ObjectReader.h>
 #include <Alembic/AbcCoreAbstract/ObjectWriter.h>
 #include <Alembic/AbcCoreAbstract/PropertyHeader.h>
+#include <Alembic/AbcCoreAbstract/ReadStats.h>
 #include <Alembic/AbcCoreAbstract/ScalarPropertyReader.h>
 #include <Alembic/AbcCoreAbstract/ScalarPropertyWriter.h>
 #include <Alembic/AbcCoreAbstract/ScalarSample.h>
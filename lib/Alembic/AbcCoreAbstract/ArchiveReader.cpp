@@ -35,6 +35,7 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreAbstract/ArchiveReader.h>
+#include <Alembic/AbcCoreAbstract/ObjectReader.h>
 
 namespace Alembic {
 namespace AbcCoreAbstract {
@@ -46,6 +47,84 @@ ArchiveReader::~ArchiveReader()
     // Nothing
 }
 
+//-*****************************************************************************
+ObjectReaderPtr ArchiveReader::findObject( const std::string &iFullName )
+{
+    ObjectReaderPtr obj = getTop();
+
+    std::size_t start = 0;
+    while ( obj && start < iFullName.size() )
+    {
+        std::size_t end = iFullName.find( '/', start );
+        if ( end == std::string::npos )
+        {
+            end = iFullName.size();
+        }
+
+        // skip over empty names, like the leading slash
+        if ( end > start )
+        {
+            obj = obj->getChild( iFullName.substr( start, end - start ) );
+        }
+
+        start = end + 1;
+    }
+
+    return obj;
+}
+
+//-*****************************************************************************
+size_t ArchiveReader::getNumIndexedObjects()
+{
+    return 0;
+}
+
+//-*****************************************************************************
+const ObjectHeader & ArchiveReader::getIndexedObjectHeader( size_t i )
+{
+    ABCA_THROW( "Out of range index in "
+                << "ArchiveReader::getIndexedObjectHeader: " << i );
+
+    // not reached
+    static ObjectHeader empty;
+    return empty;
+}
+
+//-*****************************************************************************
+const ObjectHeader *
+ArchiveReader::getIndexedObjectHeader( const std::string &iFullName )
+{
+    return NULL;
+}
+
+//-*****************************************************************************
+ReadStats ArchiveReader::getReadStats()
+{
+    return ReadStats();
+}
+
+//-*****************************************************************************
+void ArchiveReader::resetReadStats()
+{
+}
+
+//-*****************************************************************************
+bool ArchiveReader::supportsConcurrentReads()
+{
+    return false;
+}
+
+//-*****************************************************************************
+ReadStreamBindingPtr ArchiveReader::bindReadStream()
+{
+    return ReadStreamBindingPtr();
+}
+
+//-*****************************************************************************
+ReadStreamBinding::~ReadStreamBinding()
+{
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
@@ -39,7 +39,9 @@
 
 #include <Alembic/AbcCoreAbstract/Foundation.h>
 #include <Alembic/AbcCoreAbstract/ForwardDeclarations.h>
+#include <Alembic/AbcCoreAbstract/ObjectHeader.h>
 #include <Alembic/AbcCoreAbstract/ReadArraySampleCache.h>
+#include <Alembic/AbcCoreAbstract/ReadStats.h>
 
 namespace Alembic {
 namespace AbcCoreAbstract {
@@ -68,6 +70,18 @@ struct ArchiveReaderConstructor
 };
 } // End namespace IllustrationOnly
 
+//-*****************************************************************************
+//! Held onto by a thread while it reads a batch of samples from one archive,
+//! see ArchiveReader::bindReadStream.
+class ReadStreamBinding
+    : private Alembic::Util::noncopyable
+{
+public:
+    virtual ~ReadStreamBinding();
+};
+
+typedef Alembic::Util::shared_ptr<ReadStreamBinding> ReadStreamBindingPtr;
+
 //-*****************************************************************************
 //! The Archive is "the file". It has a single object, it's top object.
 //! It has no properties, but does have metadata.
@@ -122,6 +136,45 @@ public:
     //! of this archive file.
     virtual int32_t getArchiveVersion() = 0;
 
+    //! Returns the object with the given full name, like "/a/b/c", or an
+    //! empty pointer if there isn't one.  Implementations can find it
+    //! without making all of the objects above it, in which case the
+    //! returned object is not the one its parent's getChild would return.
+    //! The default walks down from the top object.
+    virtual ObjectReaderPtr findObject( const std::string &iFullName );
+
+    //! Some archives are written with an index of their objects, which
+    //! lets an object's header be found without reading the objects above
+    //! it.  Returns how many objects are in the index, or 0 if the archive
+    //! wasn't written with one.
+    virtual size_t getNumIndexedObjects();
+
+    //! Returns the header of the i'th object in the index, objects are
+    //! in the order they were created, so parents are before their children.
+    virtual const ObjectHeader & getIndexedObjectHeader( size_t i );
+
+    //! Returns the header of the indexed object with the given full name,
+    //! or NULL if there is no such object, or no index.
+    virtual const ObjectHeader *
+    getIndexedObjectHeader( const std::string &iFullName );
+
+    //! Returns what has been read so far, if the archive was asked to count
+    //! it when it was opened, otherwise everything is 0.
+    virtual ReadStats getReadStats();
+
+    //! Sets all of the read counts back to 0.
+    virtual void resetReadStats();
+
+    //! Whether samples can be read from this archive on several threads at
+    //! the same time.  The default is false.
+    virtual bool supportsConcurrentReads();
+
+    //! While the returned binding is held onto, every read the calling
+    //! thread makes from this archive uses the same one of its streams
+    //! instead of picking one for each read.  It has to be let go of on the
+    //! thread which asked for it.  The default returns an empty pointer.
+    virtual ReadStreamBindingPtr bindReadStream();
+
     //! Return self
     //! ...
     virtual ArchiveReaderPtr asArchivePtr() = 0;
@@ -138,6 +138,15 @@ public:
     virtual void setMaxNumSamplesForTimeSamplingIndex( uint32_t iIndex,
                                                        index_t iMaxIndex ) = 0;
 
+    //! Whether this archive can be written on one thread while other
+    //! archives are read or written on other threads, and whether samples
+    //! can be set on its properties from several threads at once, which it
+    //! then writes one at a time.  Objects and properties may be created
+    //! and destroyed while samples are being set on other threads, but only
+    //! from one thread at a time, and a property has to outlive any
+    //! sample being set on it.  The default is false.
+    virtual bool supportsConcurrentWrites();
+
 private:
     int8_t m_compressionHint;
 };
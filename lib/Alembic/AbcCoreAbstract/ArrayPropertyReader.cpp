@@ -46,6 +46,49 @@ ArrayPropertyReader::~ArrayPropertyReader()
     // Nothing
 }
 
+//-*****************************************************************************
+void ArrayPropertyReader::getSamples(
+    const std::vector< index_t > & iSampleIndices,
+    std::vector< ArraySamplePtr > & oSamples )
+{
+    oSamples.resize( iSampleIndices.size() );
+    for ( std::size_t i = 0; i < iSampleIndices.size(); ++i )
+    {
+        getSample( iSampleIndices[i], oSamples[i] );
+    }
+}
+
+//-*****************************************************************************
+void ArrayPropertyReader::getSamplesAs(
+    const std::vector< index_t > & iSampleIndices,
+    void *iIntoLocation,
+    PlainOldDataType iPod )
+{
+    // how many bytes each point takes up in iIntoLocation
+    std::size_t pointBytes = getDataType().getExtent();
+    if ( iPod == kStringPOD )
+    {
+        pointBytes *= sizeof( std::string );
+    }
+    else if ( iPod == kWstringPOD )
+    {
+        pointBytes *= sizeof( std::wstring );
+    }
+    else
+    {
+        pointBytes *= PODNumBytes( iPod );
+    }
+
+    char * into = static_cast< char * >( iIntoLocation );
+    for ( std::size_t i = 0; i < iSampleIndices.size(); ++i )
+    {
+        Dimensions dims;
+        getDimensions( iSampleIndices[i], dims );
+        getAs( iSampleIndices[i], into, iPod );
+        into += dims.numPoints() * pointBytes;
+    }
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
@@ -139,6 +139,25 @@ public:
     //! and std::wstring as core language-level primitives.
     virtual void getAs( index_t iSample, void *iIntoLocation,
                         PlainOldDataType iPod ) = 0;
+
+    //! Reads several samples in one call, oSamples is resized to have one
+    //! sample for each of the requested indices.  Implementations may
+    //! (and should) share the work of reading the samples, the default
+    //! just calls getSample for each index.
+    //! It will throw an exception on an out-of-range access.
+    virtual void getSamples( const std::vector< index_t > & iSampleIndices,
+                             std::vector< ArraySamplePtr > & oSamples );
+
+    //! Reads the data for each of the requested samples, one after the
+    //! other, into the memory location specified by iIntoLocation as the
+    //! requested POD type, so that it ends up laid out as
+    //! [sample][element].  The same restrictions as getAs apply, and
+    //! iIntoLocation must be big enough to hold the total number of points
+    //! (see getDimensions) of all of the requested samples.
+    //! The default just calls getDimensions and getAs for each index.
+    virtual void getSamplesAs( const std::vector< index_t > & iSampleIndices,
+                               void *iIntoLocation,
+                               PlainOldDataType iPod );
 };
 
 } // End namespace ALEMBIC_VERSION_NS
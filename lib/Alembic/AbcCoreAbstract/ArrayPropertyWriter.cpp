@@ -46,6 +46,19 @@ ArrayPropertyWriter::~ArrayPropertyWriter()
     // Nothing
 }
 
+//-*****************************************************************************
+void ArrayPropertyWriter::setSample( const ArraySample & iSamp,
+                                     const ArraySample::Key & iKey )
+{
+    setSample( iSamp );
+}
+
+//-*****************************************************************************
+bool ArrayPropertyWriter::setPrecision( uint8_t iPrecision )
+{
+    return iPrecision == 0;
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
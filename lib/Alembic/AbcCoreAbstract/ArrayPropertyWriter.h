@@ -73,6 +73,13 @@ public:
     //! treated just like regular data elements.
     virtual void setSample( const ArraySample & iSamp ) = 0;
 
+    //! Sets a sample whose key is already known, for instance because it
+    //! was read back from another archive with ArrayPropertyReader::getKey,
+    //! so it doesn't need to be hashed again.  iKey must be the key of
+    //! iSamp, the default implementation ignores it and calls setSample.
+    virtual void setSample( const ArraySample & iSamp,
+                            const ArraySample::Key & iKey );
+
     //! Set the next sample to equal the previous sample.
     //! An important feature!
     virtual void setFromPreviousSample() = 0;
@@ -86,6 +93,13 @@ public:
     //! currently set is more than the number of times provided in the Acyclic
     //! TimeSampling, an exception will be thrown.
     virtual void setTimeSamplingIndex( uint32_t iIndex ) = 0;
+
+    //! Asks for float32 samples to be stored with less, lossy, precision.
+    //! 0 is full precision, see AbcGeom::Precision for the others.  It has
+    //! to be asked for before the first sample is set.  Returns whether the
+    //! samples will be stored that way, the default implementation only
+    //! stores them at full precision.
+    virtual bool setPrecision( uint8_t iPrecision );
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -36,11 +36,97 @@
 
 #include <Alembic/AbcCoreAbstract/ArraySample.h>
 #include <Alembic/Util/Murmur3.h>
+#include <Alembic/Util/ThreadPool.h>
+#include <algorithm>
 
 namespace Alembic {
 namespace AbcCoreAbstract {
 namespace ALEMBIC_VERSION_NS {
 
+namespace {
+
+// Arrays bigger than HASH_CHUNKS_MIN_SIZE are hashed HASH_CHUNK_SIZE bytes at
+// a time, on a pool with a thread per core shared by every caller, and then
+// the digests of the chunks are hashed.  The chunk size doesn't depend on the
+// number of threads so the key is the same on every machine.
+const size_t HASH_CHUNK_SIZE = 4 * 1024 * 1024;
+const size_t HASH_CHUNKS_MIN_SIZE = 4 * HASH_CHUNK_SIZE;
+
+class HashChunkTask : public Alembic::Util::Task
+{
+public:
+    HashChunkTask( const char * iData, size_t iNumBytes, size_t iPodSize,
+                   Alembic::Util::Digest & oDigest )
+        : m_data( iData )
+        , m_numBytes( iNumBytes )
+        , m_podSize( iPodSize )
+        , m_digest( oDigest )
+    {
+    }
+
+    virtual void run()
+    {
+        MurmurHash3_x64_128( m_data, m_numBytes, m_podSize,
+                             m_digest.words );
+    }
+
+private:
+    const char * m_data;
+    size_t m_numBytes;
+    size_t m_podSize;
+    Alembic::Util::Digest & m_digest;
+};
+
+//-*****************************************************************************
+// Started the first time a big array is hashed, and never stopped since
+// samples may be hashed right up until the program exits.
+Alembic::Util::mutex g_hashPoolMutex;
+Alembic::Util::ThreadPool * g_hashPool = NULL;
+
+Alembic::Util::ThreadPool & getHashPool()
+{
+    Alembic::Util::scoped_lock l( g_hashPoolMutex );
+    if ( !g_hashPool )
+    {
+        g_hashPool = new Alembic::Util::ThreadPool();
+    }
+    return *g_hashPool;
+}
+
+//-*****************************************************************************
+void hashPODs( const void * iData, size_t iNumBytes, size_t iPodSize,
+               Alembic::Util::Digest & oDigest )
+{
+    if ( iNumBytes <= HASH_CHUNKS_MIN_SIZE )
+    {
+        MurmurHash3_x64_128( iData, iNumBytes, iPodSize, oDigest.words );
+        return;
+    }
+
+    const char * data = static_cast< const char * >( iData );
+    size_t numChunks = ( iNumBytes + HASH_CHUNK_SIZE - 1 ) / HASH_CHUNK_SIZE;
+    std::vector< Alembic::Util::Digest > digests( numChunks );
+
+    // the group only waits for our chunks, and hashes the ones the pool
+    // hasn't gotten to on this thread, so it is fine to be called from the
+    // pool's threads or from many threads at once
+    Alembic::Util::TaskGroup group( getHashPool() );
+    for ( size_t i = 0; i < numChunks; ++i )
+    {
+        size_t offset = i * HASH_CHUNK_SIZE;
+        size_t numBytes = std::min( HASH_CHUNK_SIZE, iNumBytes - offset );
+        group.add( Alembic::Util::TaskPtr( new HashChunkTask(
+            data + offset, numBytes, iPodSize, digests[i] ) ) );
+    }
+    group.wait();
+
+    MurmurHash3_x64_128( &digests.front(),
+                         numChunks * sizeof( Alembic::Util::Digest ),
+                         sizeof( uint64_t ), oDigest.words );
+}
+
+} // End anonymous namespace
+
 //-*****************************************************************************
 ArraySample::Key ArraySample::getKey() const
 {
@@ -70,61 +156,50 @@ ArraySample::Key ArraySample::getKey() const
     case kFloat32POD:
     case kFloat64POD:
     {
-        MurmurHash3_x64_128( m_data, numBytes, PODNumBytes(m_dataType.getPod()),
-            k.digest.words );
+        hashPODs( m_data, numBytes, PODNumBytes( m_dataType.getPod() ),
+                  k.digest );
     }
     break;
 
     case kStringPOD:
     {
-        std::vector <int8_t> v;
+        // hashed as if each string, and its NULL seperator, were put one
+        // after the other
+        MurmurHash3Stream hasher( sizeof( int8_t ) );
+        const int8_t nullChar = 0;
         for ( size_t j = 0; j < numPods; ++j )
         {
             const std::string &str =
                 static_cast<const std::string*>( m_data )[j];
 
-            size_t strLen = str.length();
-            for ( size_t k = 0; k < strLen; ++k )
-            {
-                v.push_back(str[k]);
-            }
-
-            // append a 0 for the NULL seperator character
-            v.push_back(0);
+            hasher.add( str.data(), str.length() );
+            hasher.add( &nullChar, sizeof( int8_t ) );
         }
 
-        int8_t * vptr = NULL;
-        if ( !v.empty() )
-            vptr = &(v.front());
-
-        MurmurHash3_x64_128( vptr, v.size(), sizeof(int8_t), k.digest.words );
+        hasher.finish( k.digest.words );
     }
     break;
 
     case kWstringPOD:
     {
+        // wchar_t isn't the same size everywhere, so every character is
+        // hashed as an int32_t
+        MurmurHash3Stream hasher( sizeof( int32_t ) );
         std::vector <int32_t> v;
         for ( size_t j = 0; j < numPods; ++j )
         {
             const std::wstring &wstr =
                 static_cast<const std::wstring*>( m_data )[j];
 
-            std::vector <int32_t> v(wstr.length());
-            size_t wlen = wstr.length();
-            for (size_t k = 0; k < wlen; ++k)
-            {
-                v[k] = wstr[k];
-            }
+            v.assign( wstr.begin(), wstr.end() );
 
             // append a 0 for the NULL seperator character
             v.push_back(0);
-        }
 
-        int32_t * vptr = NULL;
-        if ( !v.empty() )
-            vptr = &(v.front());
+            hasher.add( &( v.front() ), v.size() * sizeof( int32_t ) );
+        }
 
-        MurmurHash3_x64_128( vptr, v.size(), sizeof(int32_t), k.digest.words );
+        hasher.finish( k.digest.words );
     }
     break;
 
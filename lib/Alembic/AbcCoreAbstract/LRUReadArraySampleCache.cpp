@@ -0,0 +1,339 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/LRUReadArraySampleCache.h>
+#include <Alembic/AbcCoreAbstract/ArraySampleKey.h>
+
+#include <list>
+
+namespace Alembic {
+namespace AbcCoreAbstract {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+class LRUReadArraySampleCache::Shard
+{
+public:
+    Shard() : numHits( 0 ), numMisses( 0 ), numEvictions( 0 ) {}
+
+    struct Entry
+    {
+        Entry( const ArraySample::Key &iKey, ArraySamplePtr iSample,
+               uint64_t iTick )
+          : key( iKey ), sample( iSample ), tick( iTick ) {}
+
+        ArraySample::Key key;
+        ArraySamplePtr sample;
+
+        // when this was last used, higher is more recent
+        uint64_t tick;
+    };
+
+    // the most recently used entry is at the front
+    typedef std::list< Entry > EntryList;
+    typedef UnorderedMapUtil< EntryList::iterator >::umap_type EntryMap;
+
+    Alembic::Util::mutex mutex;
+    EntryList entries;
+    EntryMap entryMap;
+
+    uint64_t numHits;
+    uint64_t numMisses;
+    uint64_t numEvictions;
+};
+
+//-*****************************************************************************
+LRUReadArraySampleCache::LRUReadArraySampleCache( uint64_t iMaxBytes,
+                                                  std::size_t iNumShards )
+  : m_maxBytes( iMaxBytes )
+  , m_numBytes( 0 )
+  , m_tick( 0 )
+{
+    if ( iNumShards == 0 )
+    {
+        iNumShards = 1;
+    }
+
+    m_shards.resize( iNumShards );
+    for ( std::size_t i = 0; i < iNumShards; ++i )
+    {
+        m_shards[i] = new Shard();
+    }
+}
+
+//-*****************************************************************************
+LRUReadArraySampleCache::~LRUReadArraySampleCache()
+{
+    for ( std::size_t i = 0; i < m_shards.size(); ++i )
+    {
+        delete m_shards[i];
+    }
+}
+
+//-*****************************************************************************
+LRUReadArraySampleCache::Shard &
+LRUReadArraySampleCache::getShard( const ArraySample::Key &iKey )
+{
+    // StdHash uses the first word for the buckets within the shard, so use
+    // the other one to pick the shard
+    return *m_shards[ iKey.digest.words[1] % m_shards.size() ];
+}
+
+//-*****************************************************************************
+uint64_t LRUReadArraySampleCache::nextTick()
+{
+    // taken while the shard is locked, so a shard's entries are always in
+    // tick order.  Every find bumps it, so it doesn't share a lock with
+    // anything else.
+#if defined( __GNUC__ ) && __GNUC__ > 3
+    return __sync_add_and_fetch( &m_tick, 1 );
+#else
+    Alembic::Util::scoped_lock l( m_tickMutex );
+    return ++m_tick;
+#endif
+}
+
+//-*****************************************************************************
+ReadArraySampleID
+LRUReadArraySampleCache::find( const ArraySample::Key &iKey )
+{
+    Shard & shard = getShard( iKey );
+    Alembic::Util::scoped_lock l( shard.mutex );
+
+    Shard::EntryMap::iterator it = shard.entryMap.find( iKey );
+    if ( it == shard.entryMap.end() )
+    {
+        shard.numMisses ++;
+        return ReadArraySampleID();
+    }
+
+    shard.numHits ++;
+
+    // move it to the front, the iterator stays valid
+    shard.entries.splice( shard.entries.begin(), shard.entries, it->second );
+    it->second->tick = nextTick();
+    return ReadArraySampleID( iKey, it->second->sample );
+}
+
+//-*****************************************************************************
+ReadArraySampleID
+LRUReadArraySampleCache::store( const ArraySample::Key &iKey,
+                                ArraySamplePtr iSamp )
+{
+    ABCA_ASSERT( iSamp, "Cannot store a null sample" );
+
+    // too big to ever hold onto
+    if ( iKey.numBytes > m_maxBytes )
+    {
+        return ReadArraySampleID( iKey, iSamp );
+    }
+
+    {
+        Shard & shard = getShard( iKey );
+        Alembic::Util::scoped_lock l( shard.mutex );
+
+        Shard::EntryMap::iterator it = shard.entryMap.find( iKey );
+        if ( it != shard.entryMap.end() )
+        {
+            shard.entries.splice( shard.entries.begin(), shard.entries,
+                                  it->second );
+            it->second->tick = nextTick();
+            return ReadArraySampleID( iKey, it->second->sample );
+        }
+
+        shard.entries.push_front( Shard::Entry( iKey, iSamp, nextTick() ) );
+        shard.entryMap[iKey] = shard.entries.begin();
+
+        // the byte count is always updated while the shard is locked so it
+        // never disagrees with what the shards hold
+        Alembic::Util::scoped_lock bl( m_bytesMutex );
+        m_numBytes += iKey.numBytes;
+    }
+
+    evict();
+
+    return ReadArraySampleID( iKey, iSamp );
+}
+
+//-*****************************************************************************
+void LRUReadArraySampleCache::evict()
+{
+    // Only one shard is locked at a time, so the shard holding the least
+    // recently used sample is found first, and then that sample is dropped
+    // unless another thread used or dropped it in the meantime.
+    for ( ;; )
+    {
+        {
+            Alembic::Util::scoped_lock l( m_bytesMutex );
+            if ( m_numBytes <= m_maxBytes )
+            {
+                return;
+            }
+        }
+
+        bool found = false;
+        std::size_t oldestShard = 0;
+        uint64_t oldestTick = 0;
+        for ( std::size_t i = 0; i < m_shards.size(); ++i )
+        {
+            Shard & shard = *m_shards[i];
+            Alembic::Util::scoped_lock l( shard.mutex );
+
+            if ( !shard.entries.empty() &&
+                 ( !found || shard.entries.back().tick < oldestTick ) )
+            {
+                found = true;
+                oldestShard = i;
+                oldestTick = shard.entries.back().tick;
+            }
+        }
+
+        // another thread is in the middle of dropping them
+        if ( !found )
+        {
+            return;
+        }
+
+        // held onto so that the sample is released outside of the lock
+        ArraySamplePtr dropped;
+        {
+            Shard & shard = *m_shards[oldestShard];
+            Alembic::Util::scoped_lock l( shard.mutex );
+
+            if ( shard.entries.empty() ||
+                 shard.entries.back().tick != oldestTick )
+            {
+                continue;
+            }
+
+            Shard::Entry & oldest = shard.entries.back();
+            dropped = oldest.sample;
+
+            {
+                Alembic::Util::scoped_lock bl( m_bytesMutex );
+                m_numBytes -= oldest.key.numBytes;
+            }
+
+            shard.entryMap.erase( oldest.key );
+            shard.entries.pop_back();
+            shard.numEvictions ++;
+        }
+    }
+}
+
+//-*****************************************************************************
+void LRUReadArraySampleCache::clear()
+{
+    for ( std::size_t i = 0; i < m_shards.size(); ++i )
+    {
+        // released outside of the lock
+        Shard::EntryList dropped;
+
+        Shard & shard = *m_shards[i];
+        Alembic::Util::scoped_lock l( shard.mutex );
+        dropped.swap( shard.entries );
+        shard.entryMap.clear();
+
+        uint64_t numBytes = 0;
+        Shard::EntryList::iterator it;
+        for ( it = dropped.begin(); it != dropped.end(); ++it )
+        {
+            numBytes += it->key.numBytes;
+        }
+
+        Alembic::Util::scoped_lock bl( m_bytesMutex );
+        m_numBytes -= numBytes;
+    }
+}
+
+//-*****************************************************************************
+uint64_t LRUReadArraySampleCache::getNumBytes()
+{
+    Alembic::Util::scoped_lock l( m_bytesMutex );
+    return m_numBytes;
+}
+
+//-*****************************************************************************
+std::size_t LRUReadArraySampleCache::getNumSamples()
+{
+    std::size_t numSamples = 0;
+    for ( std::size_t i = 0; i < m_shards.size(); ++i )
+    {
+        Alembic::Util::scoped_lock l( m_shards[i]->mutex );
+        numSamples += m_shards[i]->entries.size();
+    }
+    return numSamples;
+}
+
+//-*****************************************************************************
+uint64_t LRUReadArraySampleCache::getNumHits()
+{
+    uint64_t numHits = 0;
+    for ( std::size_t i = 0; i < m_shards.size(); ++i )
+    {
+        Alembic::Util::scoped_lock l( m_shards[i]->mutex );
+        numHits += m_shards[i]->numHits;
+    }
+    return numHits;
+}
+
+//-*****************************************************************************
+uint64_t LRUReadArraySampleCache::getNumMisses()
+{
+    uint64_t numMisses = 0;
+    for ( std::size_t i = 0; i < m_shards.size(); ++i )
+    {
+        Alembic::Util::scoped_lock l( m_shards[i]->mutex );
+        numMisses += m_shards[i]->numMisses;
+    }
+    return numMisses;
+}
+
+//-*****************************************************************************
+uint64_t LRUReadArraySampleCache::getNumEvictions()
+{
+    uint64_t numEvictions = 0;
+    for ( std::size_t i = 0; i < m_shards.size(); ++i )
+    {
+        Alembic::Util::scoped_lock l( m_shards[i]->mutex );
+        numEvictions += m_shards[i]->numEvictions;
+    }
+    return numEvictions;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreAbstract
+} // End namespace Alembic
@@ -0,0 +1,137 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_AbcCoreAbstract_LRUReadArraySampleCache_h_
+#define _Alembic_AbcCoreAbstract_LRUReadArraySampleCache_h_
+
+#include <Alembic/AbcCoreAbstract/Foundation.h>
+#include <Alembic/AbcCoreAbstract/ReadArraySampleCache.h>
+
+namespace Alembic {
+namespace AbcCoreAbstract {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! A thread safe ReadArraySampleCache which holds onto at most a given
+//! number of bytes worth of samples, dropping the least recently used ones
+//! first.  The keys are spread across a number of separately locked shards
+//! so that many threads can find and store samples at the same time.
+//! Dropping a sample only releases the cache's reference to it, anything
+//! still holding onto the ArraySamplePtr keeps it alive.
+//! The same cache can be given to many archives (see
+//! IFactory::setSampleCache) so that identical samples are shared between
+//! them.
+class LRUReadArraySampleCache : public ReadArraySampleCache
+{
+public:
+    //! iMaxBytes is the total number of bytes of sample data this cache
+    //! will hold onto, iNumShards is the number of separately locked
+    //! buckets the keys are spread across.
+    LRUReadArraySampleCache( uint64_t iMaxBytes,
+                             std::size_t iNumShards = 16 );
+
+    virtual ~LRUReadArraySampleCache();
+
+    //! Returns the sample if we have it, and marks it as the most recently
+    //! used.
+    virtual ReadArraySampleID find( const ArraySample::Key &iKey );
+
+    //! Stores the sample, unless we already have one with the same key in
+    //! which case that one is returned instead.  If the sample on its own
+    //! is larger than the budget it is returned but not held onto.
+    virtual ReadArraySampleID store( const ArraySample::Key &iKey,
+                                     ArraySamplePtr iSamp );
+
+    //! The budget this cache was created with.
+    uint64_t getMaxBytes() const { return m_maxBytes; }
+
+    //! Total bytes of the samples currently held onto.
+    uint64_t getNumBytes();
+
+    //! Number of samples currently held onto.
+    std::size_t getNumSamples();
+
+    //! Number of find calls which returned a sample.
+    uint64_t getNumHits();
+
+    //! Number of find calls which didn't return a sample.
+    uint64_t getNumMisses();
+
+    //! Number of samples dropped to stay within the budget.
+    uint64_t getNumEvictions();
+
+    //! Drops every sample, the counters are left alone.
+    void clear();
+
+private:
+    class Shard;
+
+    Shard & getShard( const ArraySample::Key &iKey );
+
+    // stamps a sample as just used, the shard must be locked
+    uint64_t nextTick();
+
+    // drops least recently used samples until we are within the budget
+    void evict();
+
+    uint64_t m_maxBytes;
+
+    std::vector< Shard * > m_shards;
+
+    // protects m_numBytes
+    Alembic::Util::mutex m_bytesMutex;
+    uint64_t m_numBytes;
+
+    // bumped every time a sample is found or stored, the sample is stamped
+    // with it so the least recently used one can be found across shards.
+    // It is updated atomically, the mutex is only used where that isn't
+    // available.
+    Alembic::Util::mutex m_tickMutex;
+    uint64_t m_tick;
+};
+
+//-*****************************************************************************
+typedef Alembic::Util::shared_ptr<LRUReadArraySampleCache>
+    LRUReadArraySampleCachePtr;
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreAbstract
+} // End namespace Alembic
+
+#endif
@@ -0,0 +1,118 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_AbcCoreAbstract_ReadStats_h_
+#define _Alembic_AbcCoreAbstract_ReadStats_h_
+
+#include <Alembic/AbcCoreAbstract/Foundation.h>
+#include <Alembic/AbcCoreAbstract/ArraySampleKey.h>
+#include <Alembic/AbcCoreAbstract/ObjectHeader.h>
+#include <Alembic/AbcCoreAbstract/PropertyHeader.h>
+
+namespace Alembic {
+namespace AbcCoreAbstract {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! Counts of the work an archive reader has done, for working out which
+//! archives are expensive to read and why.  Archives only count these
+//! when they are asked to when they are opened.
+struct ReadStats
+{
+    ReadStats()
+      : numReads( 0 ), numBytesRead( 0 ), numSeeks( 0 ), lockWaitTime( 0.0 )
+      , numGroups( 0 ), numData( 0 ), numObjects( 0 ), numProperties( 0 )
+      , numCacheHits( 0 ), numCacheMisses( 0 ) {}
+
+    //! Reads from the file, or from its memory mapping, and their bytes.
+    uint64_t numReads;
+    uint64_t numBytesRead;
+
+    //! Reads which didn't start where the last read of their stream ended.
+    uint64_t numSeeks;
+
+    //! Seconds spent waiting for another thread to finish with a stream.
+    double lockWaitTime;
+
+    //! The file level nodes that were read, groups hold other nodes and
+    //! data hold the bytes.
+    uint64_t numGroups;
+    uint64_t numData;
+
+    //! Object and property readers that were made.
+    uint64_t numObjects;
+    uint64_t numProperties;
+
+    //! Array samples which were, or weren't, in the ReadArraySampleCache.
+    uint64_t numCacheHits;
+    uint64_t numCacheMisses;
+};
+
+//-*****************************************************************************
+//! Told about reads as they happen, for logging or profiling them.  Calls
+//! come from whichever thread is reading, so implementations must be thread
+//! safe, and should be quick since the reading thread waits for them.
+//! Only override the calls that are interesting, the rest do nothing.
+class ReadTracer
+{
+public:
+    virtual ~ReadTracer() {}
+
+    //! iSize bytes at iPos in the file were read on the stream iStreamId,
+    //! after waiting iLockWait seconds for it.
+    virtual void read( uint64_t iPos, uint64_t iSize, std::size_t iStreamId,
+                       double iLockWait ) {}
+
+    //! An object reader was made.
+    virtual void object( const ObjectHeader &iHeader ) {}
+
+    //! A property reader was made.
+    virtual void property( const PropertyHeader &iHeader ) {}
+
+    //! An array sample was looked for in the ReadArraySampleCache.
+    virtual void cacheLookup( const ArraySampleKey &iKey, bool iFound ) {}
+};
+
+typedef Alembic::Util::shared_ptr<ReadTracer> ReadTracerPtr;
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreAbstract
+} // End namespace Alembic
+
+#endif
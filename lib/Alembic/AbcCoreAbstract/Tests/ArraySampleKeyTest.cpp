@@ -0,0 +1,180 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/Util/Murmur3.h>
+#include <Alembic/Util/ThreadPool.h>
+
+#include "Assert.h"
+
+#include <vector>
+#include <iostream>
+
+//-*****************************************************************************
+namespace AbcA = Alembic::AbcCoreAbstract;
+
+//-*****************************************************************************
+void testStream()
+{
+    std::vector< char > data( 1000 );
+    for ( std::size_t i = 0; i < data.size(); ++i )
+    {
+        data[i] = ( char )( i * 7 );
+    }
+
+    Alembic::Util::Digest whole;
+    Alembic::Util::MurmurHash3_x64_128( &data.front(), data.size(), 1,
+                                        whole.words );
+
+    // pieces that start and end in the middle of a block
+    std::size_t pieceSizes[] = { 1, 3, 15, 16, 17, 100 };
+    for ( std::size_t p = 0; p < 6; ++p )
+    {
+        Alembic::Util::MurmurHash3Stream hasher( 1 );
+        for ( std::size_t i = 0; i < data.size(); i += pieceSizes[p] )
+        {
+            hasher.add( &data[i], std::min( pieceSizes[p],
+                                            data.size() - i ) );
+        }
+
+        Alembic::Util::Digest streamed;
+        hasher.finish( streamed.words );
+        TESTING_ASSERT( streamed == whole );
+    }
+}
+
+//-*****************************************************************************
+void testStringKey()
+{
+    std::string strs[] = { "abc", "", "defghijklmnopqrstuvwxyz" };
+    AbcA::DataType dtype( Alembic::Util::kStringPOD );
+    AbcA::ArraySample samp( strs, dtype, Alembic::Util::Dimensions( 3 ) );
+
+    // the same as hashing the strings with their NULL characters
+    std::string joined( "abc\0\0defghijklmnopqrstuvwxyz\0", 29 );
+    Alembic::Util::Digest digest;
+    Alembic::Util::MurmurHash3_x64_128( joined.data(), joined.size(), 1,
+                                        digest.words );
+    TESTING_ASSERT( samp.getKey().digest == digest );
+
+    std::wstring wstrs[] = { L"abc", L"def" };
+    std::wstring otherWstrs[] = { L"abc", L"xyz" };
+    AbcA::DataType wdtype( Alembic::Util::kWstringPOD );
+    AbcA::ArraySample wsamp( wstrs, wdtype, Alembic::Util::Dimensions( 2 ) );
+    AbcA::ArraySample otherWsamp( otherWstrs, wdtype,
+                                  Alembic::Util::Dimensions( 2 ) );
+    TESTING_ASSERT( wsamp.getKey() == wsamp.getKey() );
+    TESTING_ASSERT( !( wsamp.getKey() == otherWsamp.getKey() ) );
+}
+
+//-*****************************************************************************
+void testLargeKey()
+{
+    // big enough to be hashed a chunk at a time, and not a whole number of
+    // chunks
+    std::vector< Alembic::Util::float32_t > vals( 5 * 1024 * 1024 + 3 );
+    for ( std::size_t i = 0; i < vals.size(); ++i )
+    {
+        vals[i] = ( Alembic::Util::float32_t ) i;
+    }
+
+    AbcA::DataType dtype( Alembic::Util::kFloat32POD );
+    Alembic::Util::Dimensions dims( vals.size() );
+    AbcA::ArraySample::Key key =
+        AbcA::ArraySample( &vals.front(), dtype, dims ).getKey();
+    TESTING_ASSERT( key.numBytes == vals.size() * 4 );
+    TESTING_ASSERT( key ==
+        AbcA::ArraySample( &vals.front(), dtype, dims ).getKey() );
+
+    // a change in the last chunk
+    vals.back() = -1.0f;
+    TESTING_ASSERT( !( key ==
+        AbcA::ArraySample( &vals.front(), dtype, dims ).getKey() ) );
+}
+
+//-*****************************************************************************
+class KeyTask : public Alembic::Util::Task
+{
+public:
+    KeyTask( const AbcA::ArraySample & iSample, AbcA::ArraySample::Key & oKey )
+        : m_sample( iSample ), m_key( oKey ) {}
+
+    virtual void run() { m_key = m_sample.getKey(); }
+
+private:
+    const AbcA::ArraySample & m_sample;
+    AbcA::ArraySample::Key & m_key;
+};
+
+//-*****************************************************************************
+void testLargeKeysOnThreads()
+{
+    // big keys worked out on the threads of a pool at the same time share
+    // the hashing threads instead of each starting their own
+    std::vector< Alembic::Util::int32_t > vals( 5 * 1024 * 1024 );
+    for ( std::size_t i = 0; i < vals.size(); ++i )
+    {
+        vals[i] = ( Alembic::Util::int32_t ) i;
+    }
+
+    AbcA::ArraySample samp( &vals.front(),
+                            AbcA::DataType( Alembic::Util::kInt32POD ),
+                            Alembic::Util::Dimensions( vals.size() ) );
+    AbcA::ArraySample::Key key = samp.getKey();
+
+    std::vector< AbcA::ArraySample::Key > keys( 8 );
+    Alembic::Util::ThreadPool pool( 4 );
+    for ( std::size_t i = 0; i < keys.size(); ++i )
+    {
+        pool.add( Alembic::Util::TaskPtr( new KeyTask( samp, keys[i] ) ) );
+    }
+    pool.wait();
+
+    for ( std::size_t i = 0; i < keys.size(); ++i )
+    {
+        TESTING_ASSERT( keys[i] == key );
+    }
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    testStream();
+    testStringKey();
+    testLargeKey();
+    testLargeKeysOnThreads();
+    return 0;
+}
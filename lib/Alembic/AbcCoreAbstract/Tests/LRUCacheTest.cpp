@@ -0,0 +1,194 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/All.h>
+
+#include "Assert.h"
+
+#include <vector>
+#include <iostream>
+
+//-*****************************************************************************
+namespace AbcA = Alembic::AbcCoreAbstract;
+
+//-*****************************************************************************
+// makes a key and a sample of iNumInts ints, iSeed is used for the digest
+AbcA::ArraySamplePtr makeSample( std::size_t iNumInts,
+                                 Alembic::Util::uint64_t iSeed,
+                                 AbcA::ArraySample::Key & oKey )
+{
+    AbcA::DataType dtype( Alembic::Util::kInt32POD );
+    AbcA::ArraySamplePtr samp = AbcA::AllocateArraySample( dtype,
+        Alembic::Util::Dimensions( iNumInts ) );
+
+    oKey.numBytes = iNumInts * 4;
+    oKey.origPOD = Alembic::Util::kInt32POD;
+    oKey.readPOD = Alembic::Util::kInt32POD;
+    oKey.digest.words[0] = iSeed;
+    oKey.digest.words[1] = iSeed * 31;
+    return samp;
+}
+
+//-*****************************************************************************
+void testFindAndStore()
+{
+    AbcA::LRUReadArraySampleCache cache( 1000 );
+    TESTING_ASSERT( cache.getMaxBytes() == 1000 );
+
+    AbcA::ArraySample::Key key;
+    AbcA::ArraySamplePtr samp = makeSample( 10, 1, key );
+
+    TESTING_ASSERT( !cache.find( key ) );
+    TESTING_ASSERT( cache.getNumMisses() == 1 );
+
+    AbcA::ReadArraySampleID stored = cache.store( key, samp );
+    TESTING_ASSERT( stored.getSample() == samp );
+    TESTING_ASSERT( cache.getNumBytes() == 40 );
+    TESTING_ASSERT( cache.getNumSamples() == 1 );
+
+    AbcA::ReadArraySampleID found = cache.find( key );
+    TESTING_ASSERT( found && found.getSample() == samp );
+    TESTING_ASSERT( cache.getNumHits() == 1 );
+
+    // storing the same key again hands back the first sample
+    AbcA::ArraySample::Key key2;
+    AbcA::ArraySamplePtr samp2 = makeSample( 10, 1, key2 );
+    TESTING_ASSERT( cache.store( key2, samp2 ).getSample() == samp );
+    TESTING_ASSERT( cache.getNumSamples() == 1 );
+    TESTING_ASSERT( cache.getNumBytes() == 40 );
+
+    cache.clear();
+    TESTING_ASSERT( cache.getNumSamples() == 0 );
+    TESTING_ASSERT( cache.getNumBytes() == 0 );
+    TESTING_ASSERT( !cache.find( key ) );
+}
+
+//-*****************************************************************************
+void testEviction()
+{
+    // a single shard so the order is exact
+    AbcA::LRUReadArraySampleCache cache( 100, 1 );
+
+    std::vector< AbcA::ArraySample::Key > keys( 4 );
+    std::vector< AbcA::ArraySamplePtr > samps( 4 );
+    for ( std::size_t i = 0; i < 3; ++i )
+    {
+        samps[i] = makeSample( 8, i + 1, keys[i] );
+        cache.store( keys[i], samps[i] );
+    }
+    TESTING_ASSERT( cache.getNumBytes() == 96 );
+
+    // key 0 was used most recently, so key 1 will be the first to go
+    TESTING_ASSERT( cache.find( keys[0] ) );
+
+    samps[3] = makeSample( 8, 4, keys[3] );
+    cache.store( keys[3], samps[3] );
+    TESTING_ASSERT( cache.getNumEvictions() == 1 );
+    TESTING_ASSERT( cache.getNumBytes() == 96 );
+    TESTING_ASSERT( cache.getNumSamples() == 3 );
+    TESTING_ASSERT( !cache.find( keys[1] ) );
+    TESTING_ASSERT( cache.find( keys[0] ) );
+    TESTING_ASSERT( cache.find( keys[2] ) );
+    TESTING_ASSERT( cache.find( keys[3] ) );
+
+    // we still hold onto it, so it is still around
+    TESTING_ASSERT( samps[1]->size() == 8 );
+
+    // too big to hold onto, but it is handed back
+    AbcA::ArraySample::Key bigKey;
+    AbcA::ArraySamplePtr big = makeSample( 100, 5, bigKey );
+    TESTING_ASSERT( cache.store( bigKey, big ).getSample() == big );
+    TESTING_ASSERT( !cache.find( bigKey ) );
+    TESTING_ASSERT( cache.getNumSamples() == 3 );
+
+    // pushes everything else out
+    AbcA::ArraySample::Key fullKey;
+    AbcA::ArraySamplePtr full = makeSample( 25, 6, fullKey );
+    cache.store( fullKey, full );
+    TESTING_ASSERT( cache.getNumSamples() == 1 );
+    TESTING_ASSERT( cache.getNumBytes() == 100 );
+    TESTING_ASSERT( cache.getNumEvictions() == 4 );
+}
+
+//-*****************************************************************************
+void testShards()
+{
+    AbcA::LRUReadArraySampleCachePtr cache(
+        new AbcA::LRUReadArraySampleCache( 400, 4 ) );
+
+    // usable wherever a regular cache is
+    AbcA::ReadArraySampleCachePtr base = cache;
+
+    std::vector< AbcA::ArraySample::Key > keys( 20 );
+    std::vector< AbcA::ArraySamplePtr > samps( 20 );
+    for ( std::size_t i = 0; i < 20; ++i )
+    {
+        samps[i] = makeSample( 10, i + 1, keys[i] );
+        base->store( keys[i], samps[i] );
+        TESTING_ASSERT( cache->getNumBytes() <= 400 );
+    }
+
+    TESTING_ASSERT( cache->getNumSamples() == 10 );
+    TESTING_ASSERT( cache->getNumEvictions() == 10 );
+
+    // the least recently used ones went first, whichever shard they were in
+    for ( std::size_t i = 10; i < 20; ++i )
+    {
+        TESTING_ASSERT( base->find( keys[i] ).getSample() == samps[i] );
+    }
+
+    // 10 is now the most recently used, so 11 goes next
+    TESTING_ASSERT( base->find( keys[10] ) );
+
+    AbcA::ArraySample::Key newKey;
+    AbcA::ArraySamplePtr newSamp = makeSample( 10, 21, newKey );
+    base->store( newKey, newSamp );
+    TESTING_ASSERT( cache->getNumEvictions() == 11 );
+    TESTING_ASSERT( cache->getNumSamples() == 10 );
+    TESTING_ASSERT( base->find( newKey ).getSample() == newSamp );
+    TESTING_ASSERT( base->find( keys[10] ) );
+    TESTING_ASSERT( !base->find( keys[11] ) );
+    TESTING_ASSERT( base->find( keys[12] ) );
+}
+
+//-*****************************************************************************
+int main( int, char** )
+{
+    testFindAndStore();
+    testEviction();
+    testShards();
+    return 0;
+}
@@ -547,6 +547,154 @@ void testAcyclicTime3()
     testTimeSampling( tSamp, tSampTyp, numSamps );
 }
 
+//-*****************************************************************************
+void testAcyclicTime4()
+{
+    TimeVector tvec;
+
+    // lots of samples, to exercise the binary search
+    const size_t numSamps = 20000;
+
+    chrono_t ranTime = 0.0;
+    Imath::srand48( numSamps );
+
+    for ( size_t i = 0 ; i < numSamps ; ++i )
+    {
+        // sample randomly
+        ranTime += 0.001 + Imath::drand48();
+        tvec.push_back( ranTime );
+    }
+
+    const AbcA::TimeSamplingType tSampTyp( AbcA::TimeSamplingType::kAcyclic );
+    const AbcA::TimeSampling tSamp( tSampTyp, tvec );
+
+    std::cout << "Testing acyclic time, 4" << std::endl;
+
+    for ( size_t i = 0 ; i < numSamps ; ++i )
+    {
+        TESTING_ASSERT( tSamp.getFloorIndex( tvec[i], numSamps ).first ==
+                        ( index_t ) i );
+        TESTING_ASSERT( tSamp.getCeilIndex( tvec[i], numSamps ).first ==
+                        ( index_t ) i );
+
+        if ( i + 1 < numSamps )
+        {
+            chrono_t between = ( tvec[i] + tvec[i+1] ) * 0.5;
+            TESTING_ASSERT( tSamp.getFloorIndex( between, numSamps ).first ==
+                            ( index_t ) i );
+            TESTING_ASSERT( tSamp.getCeilIndex( between, numSamps ).first ==
+                            ( index_t ) i + 1 );
+        }
+    }
+
+    // only look at some of the samples
+    TESTING_ASSERT( tSamp.getFloorIndex( tvec[numSamps - 1], 10 ).first == 9 );
+    TESTING_ASSERT( tSamp.getFloorIndex( tvec[5] + 0.0005, 10 ).first == 5 );
+}
+
+//-*****************************************************************************
+void testSampleBrackets( const AbcA::TimeSampling &timeSampling,
+                         index_t numSamps )
+{
+    TimeVector times;
+    Imath::srand48( numSamps );
+
+    chrono_t minTime = timeSampling.getSampleTime( 0 );
+    chrono_t maxTime = timeSampling.getSampleTime( numSamps - 1 );
+
+    // before, on, between and after the samples
+    times.push_back( minTime - 1.0 );
+    times.push_back( maxTime + 1.0 );
+    for ( index_t i = 0 ; i < numSamps ; ++i )
+    {
+        times.push_back( timeSampling.getSampleTime( i ) );
+        times.push_back( minTime + Imath::drand48() * ( maxTime - minTime ) );
+    }
+
+    std::vector< AbcA::SampleBracket > brackets;
+    timeSampling.getSampleBrackets( times, numSamps, brackets );
+    TESTING_ASSERT( brackets.size() == times.size() );
+
+    for ( size_t i = 0 ; i < times.size() ; ++i )
+    {
+        const AbcA::SampleBracket &b = brackets[i];
+        std::pair<index_t, chrono_t> floorPair =
+            timeSampling.getFloorIndex( times[i], numSamps );
+        std::pair<index_t, chrono_t> ceilPair =
+            timeSampling.getCeilIndex( times[i], numSamps );
+
+        TESTING_ASSERT( b.floorIndex == floorPair.first );
+        TESTING_ASSERT( b.floorTime == floorPair.second );
+        TESTING_ASSERT( b.ceilIndex == ceilPair.first );
+        TESTING_ASSERT( b.ceilTime == ceilPair.second );
+        TESTING_ASSERT( b.alpha >= 0.0 && b.alpha <= 1.0 );
+
+        if ( b.floorIndex == b.ceilIndex )
+        {
+            TESTING_ASSERT( b.alpha == 0.0 );
+        }
+        else
+        {
+            TESTING_ASSERT( Imath::equalWithAbsError( b.floorTime +
+                b.alpha * ( b.ceilTime - b.floorTime ), times[i], 1e-9 ) );
+        }
+    }
+
+    // asking again, or asking a copy, gives back the same thing
+    std::vector< AbcA::SampleBracket > again;
+    AbcA::TimeSampling copied( timeSampling );
+    copied.getSampleBrackets( times, numSamps, again );
+    TESTING_ASSERT( again.size() == brackets.size() );
+    for ( size_t i = 0 ; i < again.size() ; ++i )
+    {
+        TESTING_ASSERT( again[i].floorIndex == brackets[i].floorIndex );
+        TESTING_ASSERT( again[i].ceilIndex == brackets[i].ceilIndex );
+        TESTING_ASSERT( again[i].alpha == brackets[i].alpha );
+    }
+
+    // fewer samples can't reuse what was found before
+    if ( numSamps > 1 )
+    {
+        timeSampling.getSampleBrackets( times, 1, again );
+        TESTING_ASSERT( again[1].floorIndex == 0 );
+        TESTING_ASSERT( again[1].ceilIndex == 0 );
+        TESTING_ASSERT( again[1].alpha == 0.0 );
+    }
+
+    TESTING_ASSERT_THROW( timeSampling.getSampleBrackets( times, 0, again ),
+                          Alembic::Util::Exception );
+}
+
+//-*****************************************************************************
+void testSampleBrackets()
+{
+    std::cout << "Testing sample brackets" << std::endl;
+
+    TimeVector tvec;
+    chrono_t ranTime = 0.0;
+    Imath::srand48( 1000 );
+    for ( size_t i = 0 ; i < 1000 ; ++i )
+    {
+        ranTime += 0.001 + Imath::drand48();
+        tvec.push_back( ranTime );
+    }
+
+    AbcA::TimeSampling acyclic( AbcA::TimeSamplingType(
+        AbcA::TimeSamplingType::kAcyclic ), tvec );
+    testSampleBrackets( acyclic, 1000 );
+
+    AbcA::TimeSampling uniform( 1.0 / 24.0, 2.0 );
+    testSampleBrackets( uniform, 100 );
+
+    TimeVector shutter;
+    shutter.push_back( -0.25 / 24.0 );
+    shutter.push_back( 0.0 );
+    shutter.push_back( 0.25 / 24.0 );
+    AbcA::TimeSampling cyclic( AbcA::TimeSamplingType( 3, 1.0 / 24.0 ),
+                               shutter );
+    testSampleBrackets( cyclic, 300 );
+}
+
 //-*****************************************************************************
 void testBadTypes()
 {
@@ -602,6 +750,10 @@ int main( int, char** )
     testAcyclicTime1();
     testAcyclicTime2();
     testAcyclicTime3();
+    testAcyclicTime4();
+
+    // batch lookups of floor, ceil and alpha
+    testSampleBrackets();
 
     // make sure these bad types throw
     testBadTypes();
@@ -56,11 +56,23 @@ static const chrono_t kCHRONO_EPSILON = \
 
 static const chrono_t kCHRONO_TOLERANCE = kCHRONO_EPSILON * 32.0;
 
+//-*****************************************************************************
+struct TimeSampling::BracketCache
+{
+    BracketCache() : numSamples( 0 ) {}
+
+    Alembic::Util::mutex lock;
+    std::vector< chrono_t > times;
+    index_t numSamples;
+    std::vector< SampleBracket > brackets;
+};
+
 //-*****************************************************************************
 TimeSampling::TimeSampling( const TimeSamplingType &iTimeSamplingType,
                             const std::vector< chrono_t > & iSampleTimes )
   : m_timeSamplingType( iTimeSamplingType )
   , m_sampleTimes( iSampleTimes )
+  , m_bracketCache( new BracketCache() )
 {
     init();
 }
@@ -68,6 +80,7 @@ TimeSampling::TimeSampling( const TimeSamplingType &iTimeSamplingType,
 TimeSampling::TimeSampling( chrono_t iTimePerCycle,
                             chrono_t iStartTime )
   : m_timeSamplingType( iTimePerCycle )
+  , m_bracketCache( new BracketCache() )
 {
     m_sampleTimes.resize(1);
     m_sampleTimes[0] = iStartTime;
@@ -112,6 +125,7 @@ void TimeSampling::init()
 //-*****************************************************************************
 TimeSampling::TimeSampling()
   : m_timeSamplingType( TimeSamplingType() )
+  , m_bracketCache( new BracketCache() )
 {
     m_sampleTimes.resize(1);
     m_sampleTimes[0] = 0.0;
@@ -121,6 +135,7 @@ TimeSampling::TimeSampling()
 TimeSampling::TimeSampling( const TimeSampling & copy)
   : m_timeSamplingType( copy.m_timeSamplingType )
   , m_sampleTimes( copy.m_sampleTimes )
+  , m_bracketCache( copy.m_bracketCache )
 {
     // nothing else
 }
@@ -178,36 +193,28 @@ TimeSampling::getFloorIndex( chrono_t iTime, index_t iNumSamples ) const
 
     if ( m_timeSamplingType.isAcyclic() )
     {
-        // For now, just loop since we need the index and time
-        // Later, use binary search of sorted array.
-
         assert( iTime >= minTime );
-        chrono_t prevTime = minTime;
-        index_t numSamples = m_sampleTimes.size();
+        index_t numSamples = std::min( iNumSamples,
+                                       ( index_t ) m_sampleTimes.size() );
 
-        for ( index_t idx = 1; idx < numSamples; ++idx )
-        {
-            chrono_t thisTime = m_sampleTimes[idx];
-            assert( iTime >= prevTime );
-            if ( iTime < thisTime )
-            {
-                // Okay, tIdx is greater than us.
-                // iIdx-1 is less than or equal to us.
-                // Yes, inefficient here too, will optimize later.
-                return std::pair<index_t, chrono_t>( idx-1,
-                                                     prevTime );
-            }
-
-            prevTime = thisTime;
-        }
+        // The times are strictly increasing, so the first one greater
+        // than us can be binary searched for, and the one before it is
+        // less than or equal to us.
+        std::vector< chrono_t >::const_iterator found = std::upper_bound(
+            m_sampleTimes.begin() + 1, m_sampleTimes.begin() + numSamples,
+            iTime );
 
-        // Dang, we got all the way to the end, and no thing was ever
-        // greater than us.
+        // Dang, no thing was ever greater than us.
         // This is troublesome, because we should have picked it up
         // on maxTime.
-        ABCA_THROW( "Corrupt acyclic time samples, iTime = "
-                    << iTime << ", maxTime = " << maxTime );
-        return std::pair<index_t, chrono_t>( m_sampleTimes.size()-1, maxTime );
+        if ( found == m_sampleTimes.begin() + numSamples )
+        {
+            ABCA_THROW( "Corrupt acyclic time samples, iTime = "
+                        << iTime << ", maxTime = " << maxTime );
+        }
+
+        index_t idx = ( found - m_sampleTimes.begin() ) - 1;
+        return std::pair<index_t, chrono_t>( idx, m_sampleTimes[idx] );
     }
     else if ( m_timeSamplingType.isUniform() )
     {
@@ -267,20 +274,9 @@ TimeSampling::getFloorIndex( chrono_t iTime, index_t iNumSamples ) const
         assert( rem < period + minTime );
         const size_t cycleBlockIndex = N * numCycles;
 
-        index_t sampIdx = 0;
-
-        for ( index_t i = 0 ; i < ( index_t )N ; ++i )
-        {
-            chrono_t sampleTime = m_sampleTimes[i];
-
-            if ( sampleTime > rem )
-            {
-                sampIdx = i - 1;
-                break;
-            }
-
-            sampIdx = i;
-        }
+        // the last sample in the cycle that is <= rem
+        index_t sampIdx = ( std::upper_bound( m_sampleTimes.begin(),
+            m_sampleTimes.begin() + N, rem ) - m_sampleTimes.begin() ) - 1;
 
         if ( sampIdx < 0 ) { sampIdx = 0; }
 
@@ -387,6 +383,74 @@ TimeSampling::getNearIndex( chrono_t iTime, index_t iNumSamples ) const
     else { return ceilPair; }
 }
 
+//-*****************************************************************************
+void TimeSampling::getSampleBrackets( const std::vector< chrono_t > & iTimes,
+                                      index_t iNumSamples,
+                                      std::vector< SampleBracket > & oBrackets )
+    const
+{
+    ABCA_ASSERT( iNumSamples > 0,
+        "Can't find sample brackets without any samples." );
+
+    {
+        Alembic::Util::scoped_lock l( m_bracketCache->lock );
+        if ( m_bracketCache->numSamples == iNumSamples &&
+             m_bracketCache->times == iTimes )
+        {
+            oBrackets = m_bracketCache->brackets;
+            return;
+        }
+    }
+
+    const size_t maxIndex = iNumSamples - 1;
+    const chrono_t minTime = this->getSampleTime( 0 );
+    const chrono_t maxTime = this->getSampleTime( maxIndex );
+
+    oBrackets.resize( iTimes.size() );
+    for ( size_t i = 0; i < iTimes.size(); ++i )
+    {
+        const chrono_t time = iTimes[i];
+        SampleBracket & bracket = oBrackets[i];
+
+        std::pair<index_t, chrono_t> floorPair =
+            this->getFloorIndex( time, iNumSamples );
+        bracket.floorIndex = floorPair.first;
+        bracket.floorTime = floorPair.second;
+
+        // same as getCeilIndex, but without searching for the floor again
+        std::pair<index_t, chrono_t> ceilPair;
+        const chrono_t ceilSearchTime = time - kCHRONO_EPSILON;
+        if ( ceilSearchTime <= minTime )
+        {
+            ceilPair = std::pair<index_t, chrono_t>( 0, minTime );
+        }
+        else if ( ceilSearchTime >= maxTime )
+        {
+            ceilPair = std::pair<index_t, chrono_t>( maxIndex, maxTime );
+        }
+        else
+        {
+            ceilPair = getCeilIndexHelper( this, ceilSearchTime,
+                floorPair.first, floorPair.second, maxIndex );
+        }
+        bracket.ceilIndex = ceilPair.first;
+        bracket.ceilTime = ceilPair.second;
+
+        bracket.alpha = 0.0;
+        if ( bracket.ceilTime > bracket.floorTime )
+        {
+            bracket.alpha = ( time - bracket.floorTime ) /
+                ( bracket.ceilTime - bracket.floorTime );
+            bracket.alpha = std::max( 0.0, std::min( 1.0, bracket.alpha ) );
+        }
+    }
+
+    Alembic::Util::scoped_lock l( m_bracketCache->lock );
+    m_bracketCache->times = iTimes;
+    m_bracketCache->numSamples = iNumSamples;
+    m_bracketCache->brackets = oBrackets;
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
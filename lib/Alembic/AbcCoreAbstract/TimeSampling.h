@@ -46,6 +46,25 @@ namespace AbcCoreAbstract {
 namespace ALEMBIC_VERSION_NS {
 
 
+//-*****************************************************************************
+//! The samples on either side of a time, and how far between them the time
+//! is: alpha is 0 at the floor sample and 1 at the ceil sample.  When the
+//! time is on a sample, or outside of the samples, floor and ceil are the
+//! same and alpha is 0.
+struct SampleBracket
+{
+    SampleBracket()
+      : floorIndex( 0 ), floorTime( 0.0 )
+      , ceilIndex( 0 ), ceilTime( 0.0 )
+      , alpha( 0.0 ) {}
+
+    index_t floorIndex;
+    chrono_t floorTime;
+    index_t ceilIndex;
+    chrono_t ceilTime;
+    chrono_t alpha;
+};
+
 //-*****************************************************************************
 //! The TimeSampling class's whole job is to report information about the
 //! time values that are associated with the samples that were written
@@ -121,6 +140,15 @@ public:
     std::pair<index_t, chrono_t> getNearIndex( chrono_t iTime,
         index_t iNumSamples ) const;
 
+    //! Finds the floor and ceil samples, and how far between them, for
+    //! each of iTimes, such as the shutter times of a motion blurred frame.
+    //! The last call's results are kept, so the many properties sharing
+    //! this TimeSampling can ask for the same times for little more than
+    //! the cost of a copy.  Invalid to call this with zero samples.
+    void getSampleBrackets( const std::vector< chrono_t > & iTimes,
+                            index_t iNumSamples,
+                            std::vector< SampleBracket > & oBrackets ) const;
+
 protected:
     //! A TimeSamplingType
     //! This is "Uniform", "Cyclic", or "Acyclic".
@@ -131,6 +159,11 @@ protected:
 private:
     // sanity checks the data coming in
     void init();
+
+    // the last getSampleBrackets call, shared by copies since they have the
+    // same times
+    struct BracketCache;
+    Alembic::Util::shared_ptr< BracketCache > m_bracketCache;
 };
 
 typedef Alembic::Util::shared_ptr<TimeSampling> TimeSamplingPtr;
@@ -0,0 +1,401 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreFactory/ArchivePool.h>
+
+#include <algorithm>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+namespace Alembic {
+namespace AbcCoreFactory {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+//-*****************************************************************************
+// what is checked to tell whether a file has changed since it was opened
+struct FileStamp
+{
+    Alembic::Util::uint64_t modified;
+    Alembic::Util::uint64_t modifiedNsec;
+    Alembic::Util::uint64_t size;
+    Alembic::Util::uint64_t inode;
+    Alembic::Util::uint64_t device;
+
+    bool operator==( const FileStamp & iRhs ) const
+    {
+        return modified == iRhs.modified &&
+            modifiedNsec == iRhs.modifiedNsec && size == iRhs.size &&
+            inode == iRhs.inode && device == iRhs.device;
+    }
+};
+
+//-*****************************************************************************
+bool getFileStamp( const std::string & iFileName, FileStamp & oStamp )
+{
+#ifdef _MSC_VER
+    struct __stat64 buf;
+    if ( _stat64( iFileName.c_str(), &buf ) != 0 )
+    {
+        return false;
+    }
+    oStamp.modifiedNsec = 0;
+#else
+    struct stat buf;
+    if ( stat( iFileName.c_str(), &buf ) != 0 )
+    {
+        return false;
+    }
+#if defined(__APPLE__)
+    oStamp.modifiedNsec = buf.st_mtimespec.tv_nsec;
+#elif defined(__linux__)
+    oStamp.modifiedNsec = buf.st_mtim.tv_nsec;
+#else
+    oStamp.modifiedNsec = 0;
+#endif
+#endif
+
+    oStamp.modified = buf.st_mtime;
+    oStamp.size = buf.st_size;
+    oStamp.inode = buf.st_ino;
+    oStamp.device = buf.st_dev;
+    return true;
+}
+
+//-*****************************************************************************
+// a file name along with the IFactory options which change how it's read
+struct PoolKey
+{
+    PoolKey( const std::string & iFileName, const IFactory & iFactory )
+        : fileName( iFileName )
+        , cacheHierarchy( iFactory.getHDF5CacheHierarchy() )
+        , numStreams( iFactory.getOgawaNumStreams() )
+        , readStrategy( iFactory.getOgawaReadStrategy() )
+        , preloadHierarchy( iFactory.getOgawaPreloadHierarchy() )
+        , readStats( iFactory.getReadStats() )
+        , tracer( iFactory.getReadTracer().get() )
+        , cache( iFactory.getSampleCache().get() )
+    {
+    }
+
+    bool operator<( const PoolKey & iRhs ) const
+    {
+        if ( fileName != iRhs.fileName )
+            return fileName < iRhs.fileName;
+        if ( cacheHierarchy != iRhs.cacheHierarchy )
+            return cacheHierarchy < iRhs.cacheHierarchy;
+        if ( numStreams != iRhs.numStreams )
+            return numStreams < iRhs.numStreams;
+        if ( readStrategy != iRhs.readStrategy )
+            return readStrategy < iRhs.readStrategy;
+        if ( preloadHierarchy != iRhs.preloadHierarchy )
+            return preloadHierarchy < iRhs.preloadHierarchy;
+        if ( readStats != iRhs.readStats )
+            return readStats < iRhs.readStats;
+        if ( tracer != iRhs.tracer )
+            return tracer < iRhs.tracer;
+        return cache < iRhs.cache;
+    }
+
+    std::string fileName;
+    bool cacheHierarchy;
+    std::size_t numStreams;
+    IFactory::OgawaReadStrategy readStrategy;
+    bool preloadHierarchy;
+    bool readStats;
+    const void * tracer;
+    const void * cache;
+};
+
+//-*****************************************************************************
+struct PoolEntry
+{
+    Alembic::AbcCoreAbstract::ArchiveReaderPtr archive;
+    IFactory::CoreType coreType;
+    FileStamp stamp;
+
+    // when it was last handed out, for picking which idle ones to close
+    Alembic::Util::uint64_t lastUsed;
+
+    // only the pool holds onto it
+    bool isIdle() const { return archive.use_count() == 1; }
+};
+
+typedef std::map< PoolKey, PoolEntry > PoolEntryMap;
+typedef std::pair< Alembic::Util::uint64_t, PoolEntryMap::iterator > IdleEntry;
+
+//-*****************************************************************************
+bool usedEarlier( const IdleEntry & iLhs, const IdleEntry & iRhs )
+{
+    return iLhs.first < iRhs.first;
+}
+
+//-*****************************************************************************
+// opens the file without going through a pool
+Alembic::Abc::IArchive openArchive( const std::string & iFileName,
+                                    const IFactory & iFactory,
+                                    IFactory::CoreType & oType )
+{
+    IFactory factory( iFactory );
+    factory.setArchivePool( ArchivePoolPtr() );
+    return factory.getArchive( iFileName, oType );
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+class ArchivePool::PrivateData
+{
+public:
+    PrivateData( std::size_t iMaxIdle )
+        : maxIdle( iMaxIdle ), clock( 0 ), numHits( 0 ), numMisses( 0 ) {}
+
+    Alembic::Util::mutex lock;
+    PoolEntryMap entries;
+    std::size_t maxIdle;
+    Alembic::Util::uint64_t clock;
+    Alembic::Util::uint64_t numHits;
+    Alembic::Util::uint64_t numMisses;
+};
+
+//-*****************************************************************************
+ArchivePool::ArchivePool( std::size_t iMaxIdle )
+    : m_data( new PrivateData( iMaxIdle ) )
+{
+}
+
+//-*****************************************************************************
+ArchivePool::~ArchivePool()
+{
+}
+
+//-*****************************************************************************
+Alembic::Abc::IArchive
+ArchivePool::getArchive( const std::string & iFileName,
+                         const IFactory & iFactory,
+                         IFactory::CoreType & oType )
+{
+    FileStamp stamp;
+    if ( !getFileStamp( iFileName, stamp ) )
+    {
+        // nothing there to share, let the factory say what's wrong
+        return openArchive( iFileName, iFactory, oType );
+    }
+
+    PoolKey key( iFileName, iFactory );
+
+    {
+        Alembic::Util::scoped_lock l( m_data->lock );
+        PoolEntryMap::iterator it = m_data->entries.find( key );
+        if ( it != m_data->entries.end() )
+        {
+            if ( it->second.stamp == stamp )
+            {
+                m_data->numHits ++;
+                it->second.lastUsed = ++ m_data->clock;
+                oType = it->second.coreType;
+                Alembic::Abc::IArchive archive( it->second.archive,
+                    Alembic::Abc::kWrapExisting, iFactory.getPolicy() );
+
+                // archives let go of since the last call may be over the
+                // limit now
+                trim( m_data->maxIdle );
+                return archive;
+            }
+
+            // the file has changed since, anything holding the old archive
+            // keeps it
+            m_data->entries.erase( it );
+        }
+    }
+
+    // open it without the lock so other files can be opened meanwhile
+    Alembic::Abc::IArchive archive = openArchive( iFileName, iFactory, oType );
+    if ( !archive.valid() )
+    {
+        return archive;
+    }
+
+    Alembic::Util::scoped_lock l( m_data->lock );
+    m_data->numMisses ++;
+
+    // another thread may have opened it at the same time, in which case
+    // the first one in is what everyone shares
+    PoolEntryMap::iterator it = m_data->entries.find( key );
+    if ( it != m_data->entries.end() && it->second.stamp == stamp )
+    {
+        it->second.lastUsed = ++ m_data->clock;
+        oType = it->second.coreType;
+        return Alembic::Abc::IArchive( it->second.archive,
+            Alembic::Abc::kWrapExisting, iFactory.getPolicy() );
+    }
+
+    PoolEntry & entry = m_data->entries[key];
+    entry.archive = archive.getPtr();
+    entry.coreType = oType;
+    entry.stamp = stamp;
+    entry.lastUsed = ++ m_data->clock;
+
+    trim( m_data->maxIdle );
+    return archive;
+}
+
+//-*****************************************************************************
+Alembic::Abc::IArchive
+ArchivePool::getArchive( const std::string & iFileName,
+                         const IFactory & iFactory )
+{
+    IFactory::CoreType coreType;
+    return getArchive( iFileName, iFactory, coreType );
+}
+
+//-*****************************************************************************
+void ArchivePool::erase( const std::string & iFileName )
+{
+    Alembic::Util::scoped_lock l( m_data->lock );
+    PoolEntryMap::iterator it = m_data->entries.begin();
+    while ( it != m_data->entries.end() )
+    {
+        if ( it->first.fileName == iFileName )
+        {
+            m_data->entries.erase( it++ );
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+//-*****************************************************************************
+void ArchivePool::clear()
+{
+    Alembic::Util::scoped_lock l( m_data->lock );
+    m_data->entries.clear();
+}
+
+//-*****************************************************************************
+std::size_t ArchivePool::getNumArchives()
+{
+    Alembic::Util::scoped_lock l( m_data->lock );
+    return m_data->entries.size();
+}
+
+//-*****************************************************************************
+std::size_t ArchivePool::getNumIdleArchives()
+{
+    Alembic::Util::scoped_lock l( m_data->lock );
+    std::size_t numIdle = 0;
+    for ( PoolEntryMap::iterator it = m_data->entries.begin();
+          it != m_data->entries.end(); ++it )
+    {
+        if ( it->second.isIdle() )
+        {
+            numIdle ++;
+        }
+    }
+    return numIdle;
+}
+
+//-*****************************************************************************
+std::size_t ArchivePool::getMaxIdle()
+{
+    Alembic::Util::scoped_lock l( m_data->lock );
+    return m_data->maxIdle;
+}
+
+//-*****************************************************************************
+void ArchivePool::setMaxIdle( std::size_t iMaxIdle )
+{
+    Alembic::Util::scoped_lock l( m_data->lock );
+    m_data->maxIdle = iMaxIdle;
+    trim( iMaxIdle );
+}
+
+//-*****************************************************************************
+Alembic::Util::uint64_t ArchivePool::getNumHits()
+{
+    Alembic::Util::scoped_lock l( m_data->lock );
+    return m_data->numHits;
+}
+
+//-*****************************************************************************
+Alembic::Util::uint64_t ArchivePool::getNumMisses()
+{
+    Alembic::Util::scoped_lock l( m_data->lock );
+    return m_data->numMisses;
+}
+
+//-*****************************************************************************
+void ArchivePool::trim( std::size_t iMaxIdle )
+{
+    std::vector< IdleEntry > idle;
+    for ( PoolEntryMap::iterator it = m_data->entries.begin();
+          it != m_data->entries.end(); ++it )
+    {
+        if ( it->second.isIdle() )
+        {
+            idle.push_back( std::make_pair( it->second.lastUsed, it ) );
+        }
+    }
+
+    if ( idle.size() <= iMaxIdle )
+    {
+        return;
+    }
+
+    // least recently used first
+    std::sort( idle.begin(), idle.end(), usedEarlier );
+    for ( std::size_t i = 0; i < idle.size() - iMaxIdle; ++i )
+    {
+        m_data->entries.erase( idle[i].second );
+    }
+}
+
+//-*****************************************************************************
+ArchivePoolPtr ArchivePool::getShared()
+{
+    // never destroyed, so whatever still holds onto an archive from it can
+    // let go of it safely while the process is shutting down
+    static ArchivePoolPtr * s_shared = new ArchivePoolPtr( new ArchivePool() );
+    return *s_shared;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreFactory
+} // End namespace Alembic
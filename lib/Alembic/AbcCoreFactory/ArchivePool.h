@@ -0,0 +1,122 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_AbcCoreFactory_ArchivePool_h_
+#define _Alembic_AbcCoreFactory_ArchivePool_h_
+
+#include <Alembic/AbcCoreFactory/IFactory.h>
+
+namespace Alembic {
+namespace AbcCoreFactory {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! A thread safe collection of opened archives, so that everything in a
+//! process which asks for the same file with the same IFactory options
+//! shares one archive, along with its open streams and the headers it has
+//! already read.  An archive stays in the pool while anything holds onto
+//! it (or onto its objects and properties), once nothing does it is idle
+//! and up to getMaxIdle() of the most recently used idle archives are kept
+//! open in case they are asked for again.
+//! Before an archive is handed out again the file's modification time,
+//! size and inode are checked, if any of them changed the file is opened
+//! anew, anything still holding the old archive keeps reading it.
+//! Archives opened from streams are never pooled.
+class ArchivePool : Alembic::Util::noncopyable
+{
+public:
+    //! iMaxIdle is how many archives nothing is holding onto are kept open.
+    explicit ArchivePool( std::size_t iMaxIdle = 32 );
+
+    ~ArchivePool();
+
+    //! Returns the archive for iFileName opened with iFactory's options,
+    //! opening it if this pool doesn't have it yet.  The returned archive
+    //! uses iFactory's error handler policy.
+    Alembic::Abc::IArchive getArchive( const std::string & iFileName,
+                                       const IFactory & iFactory,
+                                       IFactory::CoreType & oType );
+
+    Alembic::Abc::IArchive getArchive( const std::string & iFileName,
+                                       const IFactory & iFactory );
+
+    //! Closes the idle archives for iFileName and forgets the ones still
+    //! held, so the next getArchive opens it anew.
+    void erase( const std::string & iFileName );
+
+    //! Does erase for every file.
+    void clear();
+
+    //! Number of archives in the pool, held or idle.
+    std::size_t getNumArchives();
+
+    //! Number of archives in the pool nothing else is holding onto.
+    std::size_t getNumIdleArchives();
+
+    std::size_t getMaxIdle();
+
+    //! Changes how many idle archives are kept open, closing the least
+    //! recently used ones if there are now too many.
+    void setMaxIdle( std::size_t iMaxIdle );
+
+    //! Number of getArchive calls which reused an archive.
+    Alembic::Util::uint64_t getNumHits();
+
+    //! Number of getArchive calls which opened the file.
+    Alembic::Util::uint64_t getNumMisses();
+
+    //! The pool shared by the whole process, which IFactory uses when
+    //! setArchivePool is given it.
+    static ArchivePoolPtr getShared();
+
+private:
+    class PrivateData;
+
+    // closes least recently used idle archives until there are at most
+    // iMaxIdle, m_data must already be locked
+    void trim( std::size_t iMaxIdle );
+
+    Alembic::Util::auto_ptr< PrivateData > m_data;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreFactory
+} // End namespace Alembic
+
+#endif
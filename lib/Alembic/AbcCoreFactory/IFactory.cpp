@@ -37,6 +37,7 @@
 #include <Alembic/AbcCoreHDF5/All.h>
 #include <Alembic/AbcCoreOgawa/All.h>
 #include <Alembic/AbcCoreFactory/IFactory.h>
+#include <Alembic/AbcCoreFactory/ArchivePool.h>
 
 namespace Alembic {
 namespace AbcCoreFactory {
@@ -46,6 +47,9 @@ IFactory::IFactory()
 {
     m_cacheHierarchy = true;
     m_numStreams = 1;
+    m_readStrategy = kFileStreams;
+    m_preloadHierarchy = false;
+    m_readStats = false;
     m_policy = Alembic::Abc::ErrorHandler::kThrowPolicy;
 }
 
@@ -56,9 +60,15 @@ IFactory::~IFactory()
 Alembic::Abc::IArchive IFactory::getArchive( const std::string & iFileName,
                                             CoreType & oType )
 {
+    if ( m_archivePool )
+    {
+        return m_archivePool->getArchive( iFileName, *this, oType );
+    }
 
     // try Ogawa first, use kQuietNoop at first in case we fail
-    Alembic::AbcCoreOgawa::ReadArchive ogawa( m_numStreams );
+    Alembic::AbcCoreOgawa::ReadArchive ogawa( m_numStreams,
+        m_readStrategy == kMemoryMappedFiles, m_preloadHierarchy,
+        m_readStats, m_tracer );
     Alembic::Abc::IArchive archive( ogawa, iFileName,
         Alembic::Abc::ErrorHandler::kQuietNoopPolicy, m_cachePtr );
 
@@ -44,6 +44,9 @@ namespace Alembic {
 namespace AbcCoreFactory {
 namespace ALEMBIC_VERSION_NS {
 
+class ArchivePool;
+typedef Alembic::Util::shared_ptr< ArchivePool > ArchivePoolPtr;
+
 class IFactory
 {
 public:
@@ -58,6 +61,16 @@ public:
         kUnknown
     };
 
+    //! How Ogawa files will be read
+    enum OgawaReadStrategy
+    {
+        //! Open the file once per stream, reads lock the chosen stream
+        kFileStreams,
+
+        //! Memory map the file, reads copy from the mapping without locking
+        kMemoryMappedFiles
+    };
+
     //! Try to open a file and set oType to the one that yields a successful
     //! oType, or kUnknown if the IArchive isn't valid
     Alembic::Abc::IArchive getArchive( const std::string & iFileName,
@@ -83,7 +96,12 @@ public:
     //! Gets whether an HDF5 file will use the cached hierarchy
     bool getHDF5CacheHierarchy() const { return m_cacheHierarchy; }
 
-    //! Set the array sample cache, the HDF5 implementation optionally uses this
+    //! Set the array sample cache, identical array samples are shared
+    //! through it.  It needs to be thread safe if an Ogawa archive is read
+    //! from more than one thread.  Every archive returned by getArchive
+    //! after this uses the same cache, an
+    //! Alembic::AbcCoreAbstract::LRUReadArraySampleCache can be used to
+    //! bound how much memory they hold onto.
     void setSampleCache(
         Alembic::AbcCoreAbstract::ReadArraySampleCachePtr iCachePtr )
     {
@@ -107,8 +125,71 @@ public:
         m_numStreams = iNumStreams;
     }
 
+    //! Gets how Ogawa files will be read
+    OgawaReadStrategy getOgawaReadStrategy() const { return m_readStrategy; }
+
+    //! Sets how Ogawa files will be read, the default is kFileStreams.
+    //! If the file can not be memory mapped, kFileStreams is used with
+    //! getOgawaNumStreams() streams.
+    void setOgawaReadStrategy( OgawaReadStrategy iStrategy )
+    {
+        m_readStrategy = iStrategy;
+    }
+
+    //! Gets whether the whole hierarchy of an Ogawa file is read when it
+    //! is opened
+    bool getOgawaPreloadHierarchy() const { return m_preloadHierarchy; }
+
+    //! Sets whether every object and compound property header of an Ogawa
+    //! file is read in parallel when it is opened, instead of as they are
+    //! asked for.  Handy when the whole hierarchy is going to be walked.
+    //! The default is false.
+    void setOgawaPreloadHierarchy( bool iPreload )
+    {
+        m_preloadHierarchy = iPreload;
+    }
+
+    //! Gets whether Ogawa archives will count what they read
+    bool getReadStats() const { return m_readStats; }
+
+    //! Sets whether Ogawa archives count the bytes, seeks, stream lock
+    //! waits, cache hits, objects and properties they read, which can then
+    //! be had from IArchive::getReadStats.  It costs a little on every read,
+    //! so the default is false.
+    void setReadStats( bool iReadStats )
+    {
+        m_readStats = iReadStats;
+    }
+
+    //! Gets the tracer handed to Ogawa archives
+    Alembic::AbcCoreAbstract::ReadTracerPtr getReadTracer() const
+    {
+        return m_tracer;
+    }
+
+    //! Sets a tracer which Ogawa archives tell about each read, and each
+    //! object and property made, as they happen.  Every archive returned by
+    //! getArchive after this shares it.  The default is none.
+    void setReadTracer( Alembic::AbcCoreAbstract::ReadTracerPtr iTracer )
+    {
+        m_tracer = iTracer;
+    }
+
+    //! Gets the pool archives are shared through
+    ArchivePoolPtr getArchivePool() const { return m_archivePool; }
+
+    //! Sets a pool to take the archives getArchive opens by file name from,
+    //! so that every IFactory with the same options which uses the pool
+    //! gets the same archive for the same file instead of opening it again.
+    //! ArchivePool::getShared() is the one for the whole process.  The
+    //! default is none, every getArchive call opens the file.
+    void setArchivePool( ArchivePoolPtr iPool )
+    {
+        m_archivePool = iPool;
+    }
+
     //! Gets the error handler policy
-    Alembic::Abc::ErrorHandler::Policy getPolicy() { return m_policy; }
+    Alembic::Abc::ErrorHandler::Policy getPolicy() const { return m_policy; }
 
     //! Sets the error handler policy, the default is kThrowPolicy
     void setPolicy( Alembic::Abc::ErrorHandler::Policy iPolicy )
@@ -119,7 +200,12 @@ public:
 private:
     bool m_cacheHierarchy;
     size_t m_numStreams;
+    OgawaReadStrategy m_readStrategy;
+    bool m_preloadHierarchy;
+    bool m_readStats;
+    Alembic::AbcCoreAbstract::ReadTracerPtr m_tracer;
     Alembic::AbcCoreAbstract::ReadArraySampleCachePtr m_cachePtr;
+    ArchivePoolPtr m_archivePool;
     Alembic::Abc::ErrorHandler::Policy m_policy;
 
 };
@@ -38,6 +38,7 @@
 #include <Alembic/AbcCoreOgawa/ReadUtil.h>
 #include <Alembic/AbcCoreOgawa/StreamManager.h>
 #include <Alembic/AbcCoreOgawa/OrImpl.h>
+#include <Alembic/Util/Murmur3.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -50,12 +51,22 @@ AprImpl::AprImpl( AbcA::CompoundPropertyReaderPtr iParent,
   : m_parent( iParent )
   , m_group( iGroup )
   , m_header( iHeader )
+  , m_archive( NULL )
 {
     // Validate all inputs.
     ABCA_ASSERT( m_parent, "Invalid parent" );
     ABCA_ASSERT( m_group, "Invalid array property group" );
     ABCA_ASSERT( m_header, "Invalid header" );
 
+    m_archive = Alembic::Util::dynamic_pointer_cast< ArImpl,
+        AbcA::ArchiveReader > ( m_parent->getObject()->getArchive() ).get();
+    ABCA_ASSERT( m_archive, "Invalid archive" );
+
+    if ( m_archive->getReadStatsCollector() )
+    {
+        m_archive->getReadStatsCollector()->property( m_header->header );
+    }
+
     if ( m_header->header.getPropertyType() != AbcA::kArrayProperty )
     {
         ABCA_THROW( "Attempted to create a ArrayPropertyReader from a "
@@ -104,14 +115,79 @@ void AprImpl::getSample( index_t iSampleIndex, AbcA::ArraySamplePtr &oSample )
 {
     size_t index = m_header->verifyIndex( iSampleIndex ) * 2;
 
-    StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
-        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
-
-    std::size_t id = streamId->getID();
+    StreamID streamId( m_archive->getStreamManager() );
+    std::size_t id = streamId.getID();
     Ogawa::IDataPtr dims = m_group->getData(index + 1, id);
     Ogawa::IDataPtr data = m_group->getData(index, id);
 
-    ReadArraySample( dims, data, id, m_header->header.getDataType(), oSample );
+    readSample( dims, data, index, id, oSample );
+}
+
+//-*****************************************************************************
+void AprImpl::readSample( Ogawa::IDataPtr iDims, Ogawa::IDataPtr iData,
+                          std::size_t iIndex, std::size_t iThreadId,
+                          AbcA::ArraySamplePtr &oSample )
+{
+    // if we are caching, use the key stored with the data to see if we
+    // already have this sample
+    AbcA::ReadArraySampleCachePtr cache =
+        m_archive->getReadArraySampleCachePtr();
+
+    AbcA::ArraySample::Key key;
+    bool foundDigest = false;
+    if ( cache && iData->getSize() >= 16 )
+    {
+        key.readPOD = m_header->header.getDataType().getPod();
+        key.origPOD = key.readPOD;
+        key.numBytes = ReadDataSize( iData, iThreadId,
+                                     m_header->isCompressed );
+        iData->read( 16, key.digest.d, 0, iThreadId );
+        foundDigest = true;
+
+        // the stored digest only covers the bytes, so the extent and the
+        // dimensions are mixed in to keep V3f[10] and float[30] apart
+        Util::Dimensions dims;
+        ReadDimensions( iDims, iData, iThreadId,
+                        m_header->header.getDataType(), dims,
+                        m_header->isCompressed );
+
+        std::vector< Util::uint64_t > shape;
+        shape.push_back( m_header->header.getDataType().getExtent() );
+        shape.push_back( dims.rank() );
+        for ( std::size_t i = 0; i < dims.rank(); ++i )
+        {
+            shape.push_back( dims[i] );
+        }
+
+        Util::MurmurHash3Stream hash( sizeof( Util::uint64_t ) );
+        hash.add( key.digest.d, 16 );
+        hash.add( &shape.front(), shape.size() * sizeof( Util::uint64_t ) );
+        hash.finish( key.digest.d );
+
+        AbcA::ReadArraySampleID found = cache->find( key );
+        if ( m_archive->getReadStatsCollector() )
+        {
+            m_archive->getReadStatsCollector()->cacheLookup( key, found );
+        }
+
+        if ( found )
+        {
+            oSample = found.getSample();
+            return;
+        }
+    }
+
+    ReadArraySample( iDims, iData, iThreadId, m_header->header.getDataType(),
+                     oSample, m_header->isCompressed, m_group, iIndex );
+
+    if ( foundDigest )
+    {
+        AbcA::ReadArraySampleID stored = cache->store( key, oSample );
+        if ( stored )
+        {
+            oSample = stored.getSample();
+        }
+    }
 }
 
 //-*****************************************************************************
@@ -145,17 +221,15 @@ bool AprImpl::getKey( index_t iSampleIndex, AbcA::ArraySampleKey & oKey )
     // * 2 for Array properties (since we also write the dimensions)
     size_t index = m_header->verifyIndex( iSampleIndex ) * 2;
 
-    StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
-        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
-
-    std::size_t id = streamId->getID();
+    StreamID streamId( m_archive->getStreamManager() );
+    std::size_t id = streamId.getID();
     Ogawa::IDataPtr data = m_group->getData( index, id );
 
     if ( data )
     {
         if ( data->getSize() >= 16 )
         {
-            oKey.numBytes = data->getSize() - 16;
+            oKey.numBytes = ReadDataSize( data, id, m_header->isCompressed );
             data->read( 16, oKey.digest.d, 0, id );
         }
 
@@ -177,14 +251,13 @@ void AprImpl::getDimensions( index_t iSampleIndex,
 {
     size_t index = m_header->verifyIndex( iSampleIndex ) * 2;
 
-    StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
-        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
-
-    std::size_t id = streamId->getID();
+    StreamID streamId( m_archive->getStreamManager() );
+    std::size_t id = streamId.getID();
     Ogawa::IDataPtr dims = m_group->getData(index + 1, id);
     Ogawa::IDataPtr data = m_group->getData(index, id);
 
-    ReadDimensions( dims, data, id, m_header->header.getDataType(), oDim );
+    ReadDimensions( dims, data, id, m_header->header.getDataType(), oDim,
+                    m_header->isCompressed );
 
 }
 
@@ -194,12 +267,109 @@ void AprImpl::getAs( index_t iSampleIndex, void *iIntoLocation,
 {
     size_t index = m_header->verifyIndex( iSampleIndex ) * 2;
 
-    StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
-        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
-
-    std::size_t id = streamId->getID();
+    StreamID streamId( m_archive->getStreamManager() );
+    std::size_t id = streamId.getID();
     Ogawa::IDataPtr data = m_group->getData( index, id );
-    ReadData( iIntoLocation, data, id, m_header->header.getDataType(), iPod );
+    ReadData( iIntoLocation, data, id, m_header->header.getDataType(), iPod,
+              m_header->isCompressed, m_group, index );
+}
+
+//-*****************************************************************************
+void AprImpl::getSamples( const std::vector< index_t > & iSampleIndices,
+                          std::vector< AbcA::ArraySamplePtr > & oSamples )
+{
+    oSamples.resize( iSampleIndices.size() );
+
+    // use the one stream for the whole batch
+    StreamID streamId( m_archive->getStreamManager() );
+    std::size_t id = streamId.getID();
+
+    Ogawa::IDataPtr prevDims;
+    Ogawa::IDataPtr prevData;
+    for ( std::size_t i = 0; i < iSampleIndices.size(); ++i )
+    {
+        size_t index = m_header->verifyIndex( iSampleIndices[i] ) * 2;
+        Ogawa::IDataPtr dims = m_group->getData(index + 1, id);
+        Ogawa::IDataPtr data = m_group->getData(index, id);
+
+        // repeated samples are only written once, so if this one is the
+        // same as the last we can share it
+        if ( i > 0 && data->getPos() == prevData->getPos() &&
+             dims->getPos() == prevDims->getPos() )
+        {
+            oSamples[i] = oSamples[i - 1];
+        }
+        else
+        {
+            readSample( dims, data, index, id, oSamples[i] );
+        }
+
+        prevDims = dims;
+        prevData = data;
+    }
+}
+
+//-*****************************************************************************
+void AprImpl::getSamplesAs( const std::vector< index_t > & iSampleIndices,
+                            void *iIntoLocation,
+                            Alembic::Util::PlainOldDataType iPod )
+{
+    const AbcA::DataType & dataType = m_header->header.getDataType();
+
+    // how many bytes each point takes up in iIntoLocation
+    std::size_t pointBytes = dataType.getExtent();
+    if ( iPod == Alembic::Util::kStringPOD )
+    {
+        pointBytes *= sizeof( std::string );
+    }
+    else if ( iPod == Alembic::Util::kWstringPOD )
+    {
+        pointBytes *= sizeof( std::wstring );
+    }
+    else
+    {
+        pointBytes *= PODNumBytes( iPod );
+    }
+
+    // if no conversion is needed, we can read all of the data into place
+    // at once, otherwise each sample goes through ReadData
+    bool readAtOnce = ( !m_header->isCompressed &&
+                        iPod == dataType.getPod() &&
+                        iPod != Alembic::Util::kStringPOD &&
+                        iPod != Alembic::Util::kWstringPOD );
+
+    StreamID streamId( m_archive->getStreamManager() );
+    std::size_t id = streamId.getID();
+
+    std::vector< Ogawa::IDataPtr > datas;
+    std::vector< void * > intoLocations;
+    char * into = static_cast< char * >( iIntoLocation );
+    for ( std::size_t i = 0; i < iSampleIndices.size(); ++i )
+    {
+        size_t index = m_header->verifyIndex( iSampleIndices[i] ) * 2;
+        Ogawa::IDataPtr dims = m_group->getData(index + 1, id);
+        Ogawa::IDataPtr data = m_group->getData(index, id);
+
+        Alembic::Util::Dimensions dim;
+        ReadDimensions( dims, data, id, dataType, dim,
+                        m_header->isCompressed );
+
+        if ( readAtOnce )
+        {
+            datas.push_back( data );
+            intoLocations.push_back( into );
+        }
+        else
+        {
+            ReadData( into, data, id, dataType, iPod,
+                      m_header->isCompressed, m_group, index );
+        }
+
+        into += dim.numPoints() * pointBytes;
+    }
+
+    // skip the keys
+    Ogawa::IData::readMany( datas, 16, intoLocations, id );
 }
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -43,6 +43,8 @@ namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+class ArImpl;
+
 //-*****************************************************************************
 class AprImpl :
     public AbcA::ArrayPropertyReader,
@@ -73,9 +75,20 @@ public:
     virtual bool isScalarLike();
     virtual void getAs( index_t iSample, void *iIntoLocation,
                         Alembic::Util::PlainOldDataType iPod );
+    virtual void getSamples( const std::vector< index_t > & iSampleIndices,
+                             std::vector< AbcA::ArraySamplePtr > & oSamples );
+    virtual void getSamplesAs( const std::vector< index_t > & iSampleIndices,
+                               void *iIntoLocation,
+                               Alembic::Util::PlainOldDataType iPod );
 
 private:
 
+    // reads the sample, or finds it in the cache, iIndex is where iData is
+    // within m_group
+    void readSample( Ogawa::IDataPtr iDims, Ogawa::IDataPtr iData,
+                     std::size_t iIndex, std::size_t iThreadId,
+                     AbcA::ArraySamplePtr &oSample );
+
     // Parent compound property writer. It must exist.
     AbcA::CompoundPropertyReaderPtr m_parent;
 
@@ -84,6 +97,10 @@ private:
 
     // Stores the PropertyHeader and other info
     PropertyHeaderPtr m_header;
+
+    // The archive we belong to, kept alive by m_parent.  Held onto so each
+    // read doesn't need to look it up and cast it.
+    ArImpl * m_archive;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
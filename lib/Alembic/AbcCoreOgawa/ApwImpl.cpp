@@ -46,14 +46,23 @@ namespace ALEMBIC_VERSION_NS {
 ApwImpl::ApwImpl( AbcA::CompoundPropertyWriterPtr iParent,
                   Ogawa::OGroupPtr iGroup,
                   PropertyHeaderPtr iHeader,
-                  size_t iIndex ) :
+                  size_t iIndex,
+                  Util::int8_t iCompressionLevel,
+                  Util::uint32_t iDeltaInterval ) :
     m_parent( iParent ), m_header( iHeader ), m_group( iGroup ), m_dims( 1 ),
-    m_index( iIndex )
+    m_index( iIndex ), m_compressionLevel( -1 ), m_precision( kFullPrecision ),
+    m_deltaInterval( 0 ), m_keyframeIndex( 0 )
 {
     ABCA_ASSERT( m_parent, "Invalid parent" );
     ABCA_ASSERT( m_header, "Invalid property header" );
     ABCA_ASSERT( m_group, "Invalid group" );
 
+    if ( m_header->isCompressed )
+    {
+        m_compressionLevel = iCompressionLevel < 0 ? 0 : iCompressionLevel;
+        m_deltaInterval = iDeltaInterval;
+    }
+
     if ( m_header->header.getPropertyType() != AbcA::kArrayProperty )
     {
         ABCA_THROW( "Attempted to create a ArrayPropertyWriter from a "
@@ -105,6 +114,8 @@ ApwImpl::~ApwImpl()
 //-*****************************************************************************
 void ApwImpl::setFromPreviousSample()
 {
+    Alembic::Util::scoped_lock l(
+        GetWriteMutex( this->getObject()->getArchive() ) );
 
     // Make sure we aren't writing more samples than we have times for
     // This applies to acyclic sampling only
@@ -129,6 +140,17 @@ void ApwImpl::setFromPreviousSample()
 //-*****************************************************************************
 void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
 {
+    // The Key helps us analyze the sample.
+    setSample( iSamp, iSamp.getKey() );
+}
+
+//-*****************************************************************************
+void ApwImpl::setSample( const AbcA::ArraySample & iSamp,
+                         const AbcA::ArraySample::Key & iKey )
+{
+    Alembic::Util::scoped_lock l(
+        GetWriteMutex( this->getObject()->getArchive() ) );
+
     // Make sure we aren't writing more samples than we have times for
     // This applies to acyclic sampling only
     ABCA_ASSERT(
@@ -143,8 +165,13 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
         ", does not match the DataType of the Array property: " <<
         m_header->header.getDataType() );
 
-    // The Key helps us analyze the sample.
-     AbcA::ArraySample::Key key = iSamp.getKey();
+    ABCA_ASSERT( iKey.numBytes == iSamp.getDataType().getNumBytes() *
+                 iSamp.getDimensions().numPoints() ||
+                 iKey.origPOD == Alembic::Util::kStringPOD ||
+                 iKey.origPOD == Alembic::Util::kWstringPOD,
+        "Key with " << iKey.numBytes << " bytes doesn't match the sample" );
+
+    AbcA::ArraySample::Key key = iKey;
 
      // mask out the non-string POD since Ogawa can safely share the same data
      // even if it originated from a different POD
@@ -157,6 +184,17 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
         key.readPOD = Alembic::Util::kInt8POD;
     }
 
+    // a reduced precision sample reads back differently than the full one,
+    // so it can't share the same key, readers and caches would confuse them
+    if ( m_precision != kFullPrecision &&
+         iSamp.getDataType().getPod() == Alembic::Util::kFloat32POD )
+    {
+        Util::uint64_t precision = m_precision;
+        Util::uint64_t numBytes = key.numBytes;
+        Util::SpookyHash::ShortEnd( key.digest.words[0], key.digest.words[1],
+                                    precision, numBytes );
+    }
+
     // We need to write the sample
     if ( m_header->nextSampleIndex == 0  ||
          !( m_previousWrittenSampleID &&
@@ -180,11 +218,37 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
         // Write this sample, which will update its internal
         // cache of what the previously written sample was.
         AbcA::ArchiveWriterPtr awp = this->getObject()->getArchive();
+        WrittenSampleMap & writtenSamples =
+            GetWrittenSampleMap( awp, m_header->isCompressed, m_precision );
+
+        // Write what changed since the previous sample, unless a keyframe
+        // is due or this sample has already been written elsewhere.
+        WrittenSampleIDPtr written;
+        if ( m_deltaInterval > 0 && !m_previousData.empty() &&
+             m_header->nextSampleIndex - m_keyframeIndex < m_deltaInterval &&
+             !writtenSamples.find( key ) )
+        {
+            written = WriteDeltaData( m_group, iSamp, key, m_previousData,
+                                      m_compressionLevel );
+        }
 
-        // Write the sample.
-        // This distinguishes between string, wstring, and regular arrays.
-        m_previousWrittenSampleID =
-            WriteData( GetWrittenSampleMap( awp ), m_group, iSamp, key );
+        if ( !written )
+        {
+            // Write the sample.
+            // This distinguishes between string, wstring, and regular arrays.
+            written = WriteData( writtenSamples, m_group, iSamp, key,
+                                 m_compressionLevel, m_precision );
+            m_keyframeIndex = m_header->nextSampleIndex;
+        }
+
+        m_previousWrittenSampleID = written;
+
+        if ( m_deltaInterval > 0 )
+        {
+            const Util::uint8_t * data =
+                static_cast< const Util::uint8_t * >( iSamp.getData() );
+            m_previousData.assign( data, data + key.numBytes );
+        }
 
         m_dims = iSamp.getDimensions();
         WriteDimensions( m_group, m_dims, iSamp.getDataType().getPod() );
@@ -254,6 +318,40 @@ void ApwImpl::setTimeSamplingIndex( Util::uint32_t iIndex )
     m_header->timeSamplingIndex = iIndex;
 }
 
+//-*****************************************************************************
+bool ApwImpl::setPrecision( Util::uint8_t iPrecision )
+{
+    Alembic::Util::scoped_lock l(
+        GetWriteMutex( this->getObject()->getArchive() ) );
+
+    // only floats can be reduced, and only before anything is written
+    if ( iPrecision >= kNumDataPrecisions ||
+         m_header->nextSampleIndex > 0 ||
+         ( iPrecision != kFullPrecision &&
+           m_header->header.getDataType().getPod() !=
+           Alembic::Util::kFloat32POD ) )
+    {
+        return iPrecision == m_precision;
+    }
+
+    m_precision = ( DataPrecision ) iPrecision;
+
+    // reduced samples are written the way compressed samples are, but not
+    // as deltas
+    if ( m_precision != kFullPrecision )
+    {
+        m_deltaInterval = 0;
+        if ( !m_header->isCompressed )
+        {
+            m_header->isCompressed = true;
+            m_compressionLevel = 0;
+            UseCompression( this->getObject()->getArchive() );
+        }
+    }
+
+    return true;
+}
+
 //-*****************************************************************************
 const AbcA::PropertyHeader & ApwImpl::getHeader() const
 {
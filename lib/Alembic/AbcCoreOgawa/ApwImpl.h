@@ -53,10 +53,14 @@ protected:
     friend class CpwData;
 
     //-*************************************************************************
+    // iCompressionLevel and iDeltaInterval are only used if iHeader is
+    // compressed
     ApwImpl( AbcA::CompoundPropertyWriterPtr iParent,
              Ogawa::OGroupPtr iGroup,
              PropertyHeaderPtr iHeader,
-             size_t iIndex );
+             size_t iIndex,
+             Util::int8_t iCompressionLevel = -1,
+             Util::uint32_t iDeltaInterval = 0 );
 
     virtual AbcA::ArrayPropertyWriterPtr asArrayPtr();
 
@@ -65,9 +69,13 @@ public:
 
     // ArrayPropertyWriter overrides
     virtual void setSample( const AbcA::ArraySample & iSamp );
+
+    virtual void setSample( const AbcA::ArraySample & iSamp,
+                            const AbcA::ArraySample::Key & iKey );
     virtual void setFromPreviousSample();
     virtual size_t getNumSamples();
     virtual void setTimeSamplingIndex( Util::uint32_t iIndex );
+    virtual bool setPrecision( Util::uint8_t iPrecision );
 
     // BasePropertyWriter overrides
     virtual const AbcA::PropertyHeader & getHeader() const;
@@ -94,6 +102,22 @@ private:
     AbcA::Dimensions m_dims;
 
     size_t m_index;
+
+    // -1 unless the samples are compressed
+    Util::int8_t m_compressionLevel;
+
+    // only float32 samples are reduced, see setPrecision
+    DataPrecision m_precision;
+
+    // 0 unless samples are written as what changed since the previous one,
+    // with a keyframe at least every m_deltaInterval samples
+    Util::uint32_t m_deltaInterval;
+
+    // the index of the last sample written whole
+    Util::uint32_t m_keyframeIndex;
+
+    // the bytes of the previous sample, what the next delta is against
+    std::vector< Util::uint8_t > m_previousData;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
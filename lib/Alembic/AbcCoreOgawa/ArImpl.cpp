@@ -38,18 +38,28 @@
 #include <Alembic/AbcCoreOgawa/OrData.h>
 #include <Alembic/AbcCoreOgawa/OrImpl.h>
 #include <Alembic/AbcCoreOgawa/ReadUtil.h>
+#include <Alembic/AbcCoreOgawa/ReadWrite.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
 //-*****************************************************************************
+// reads from a memory mapped archive don't lock, so only the default stream
+// is handed out in that case
 ArImpl::ArImpl( const std::string &iFileName,
-                std::size_t iNumStreams )
+                std::size_t iNumStreams,
+                bool iUseMMap,
+                bool iPreloadHierarchy,
+                bool iCollectStats,
+                AbcA::ReadTracerPtr iTracer )
   : m_fileName( iFileName )
-  , m_archive( iFileName, iNumStreams )
+  , m_stats( ( iCollectStats || iTracer ) ?
+             new ReadStatsCollector( iCollectStats, iTracer ) : NULL )
+  , m_archive( iFileName, iNumStreams, iUseMMap, m_stats )
   , m_header( new AbcA::ObjectHeader() )
-  , m_manager( iNumStreams )
+  , m_manager( m_archive.isMemoryMapped() ? 1 : iNumStreams )
+  , m_indexRead( false )
 {
     ABCA_ASSERT( m_archive.isValid(),
                  "Could not open as Ogawa file: " << m_fileName );
@@ -58,6 +68,18 @@ ArImpl::ArImpl( const std::string &iFileName,
         "Ogawa file not cleanly closed while being written: " << m_fileName );
 
     init();
+
+    if ( iPreloadHierarchy )
+    {
+        // there is no point having more threads than streams to read with,
+        // unless the reads don't need a stream of their own
+        std::size_t numThreads = Alembic::Util::ThreadPool::getNumCores();
+        if ( !m_archive.isMemoryMapped() && iNumStreams < numThreads )
+        {
+            numThreads = iNumStreams;
+        }
+        preloadHierarchy( numThreads );
+    }
 }
 
 //-*****************************************************************************
@@ -65,6 +87,7 @@ ArImpl::ArImpl( const std::vector< std::istream * > & iStreams )
   : m_archive( iStreams )
   , m_header( new AbcA::ObjectHeader() )
   , m_manager( iStreams.size() )
+  , m_indexRead( false )
 {
     ABCA_ASSERT( m_archive.isValid(),
                  "Could not open as Ogawa file from provided streams." );
@@ -140,6 +163,176 @@ void ArImpl::init()
 
 }
 
+//-*****************************************************************************
+void ArImpl::preloadHierarchy( std::size_t iNumThreads )
+{
+    Alembic::Util::ThreadPool pool( iNumThreads > 0 ? iNumThreads : 1 );
+    m_data->preload( pool, *this );
+
+    // rethrows the first error any of the tasks hit
+    pool.wait();
+}
+
+//-*****************************************************************************
+void ArImpl::readObjectIndex()
+{
+    Alembic::Util::scoped_lock l( m_indexLock );
+
+    if ( m_indexRead )
+    {
+        return;
+    }
+
+    // the index is written after the indexed meta data, see AwImpl
+    Ogawa::IGroupPtr group = m_archive.getGroup();
+    if ( group->getNumChildren() > 6 && group->isChildData( 6 ) )
+    {
+        StreamID streamId( m_manager );
+        ReadObjectIndex( group->getData( 6, streamId.getID() ),
+                         streamId.getID(), m_indexMetaData,
+                         m_indexHeaders, m_indexChildIndices );
+
+        for ( std::size_t i = 0; i < m_indexHeaders.size(); ++i )
+        {
+            m_indexMap[m_indexHeaders[i]->getFullName()] = i;
+        }
+    }
+
+    m_indexRead = true;
+}
+
+//-*****************************************************************************
+// Only the groups along the path are read, light where possible, and the
+// objects above the one we want are never made.  With an object index the
+// child headers along the way don't need to be read either.
+AbcA::ObjectReaderPtr ArImpl::findObject( const std::string &iFullName )
+{
+    std::vector< std::string > names;
+    std::size_t start = 0;
+    while ( start < iFullName.size() )
+    {
+        std::size_t end = iFullName.find( '/', start );
+        if ( end == std::string::npos )
+        {
+            end = iFullName.size();
+        }
+
+        if ( end > start )
+        {
+            names.push_back( iFullName.substr( start, end - start ) );
+        }
+
+        start = end + 1;
+    }
+
+    if ( names.empty() )
+    {
+        return getTop();
+    }
+
+    readObjectIndex();
+
+    StreamID streamId( m_manager );
+    std::size_t id = streamId.getID();
+
+    Ogawa::IGroupPtr group = m_archive.getGroup()->getGroup( 2, true, id );
+    ObjectHeaderPtr header;
+    std::string fullName;
+
+    for ( std::size_t i = 0; i < names.size() && group; ++i )
+    {
+        std::string parentName = fullName;
+        fullName += "/" + names[i];
+        header.reset();
+        std::size_t childIndex = 0;
+
+        if ( !m_indexHeaders.empty() )
+        {
+            std::map< std::string, std::size_t >::iterator fiter =
+                m_indexMap.find( fullName );
+            if ( fiter != m_indexMap.end() )
+            {
+                header = m_indexHeaders[fiter->second];
+                childIndex = m_indexChildIndices[fiter->second];
+            }
+        }
+        else
+        {
+            // the child headers are always the last child of the group
+            std::size_t numChildren = group->getNumChildren();
+            if ( numChildren > 0 && ( group->isLight() ||
+                 group->isChildData( numChildren - 1 ) ) )
+            {
+                std::vector< ObjectHeaderPtr > headers;
+                ReadObjectHeaders( group, numChildren - 1, id, parentName,
+                                   m_indexMetaData, headers );
+
+                for ( std::size_t j = 0; j < headers.size(); ++j )
+                {
+                    if ( headers[j]->getName() == names[i] )
+                    {
+                        header = headers[j];
+                        childIndex = j;
+                        break;
+                    }
+                }
+            }
+        }
+
+        if ( !header )
+        {
+            return AbcA::ObjectReaderPtr();
+        }
+
+        // the object we are after needs all of its group
+        group = group->getGroup( childIndex + 1, i + 1 < names.size(), id );
+    }
+
+    if ( !group )
+    {
+        return AbcA::ObjectReaderPtr();
+    }
+
+    OrDataPtr data( new OrData( group, fullName, id, *this,
+                                m_indexMetaData ) );
+    return AbcA::ObjectReaderPtr(
+        new OrImpl( shared_from_this(), data, header ) );
+}
+
+//-*****************************************************************************
+size_t ArImpl::getNumIndexedObjects()
+{
+    readObjectIndex();
+    return m_indexHeaders.size();
+}
+
+//-*****************************************************************************
+const AbcA::ObjectHeader & ArImpl::getIndexedObjectHeader( size_t i )
+{
+    readObjectIndex();
+
+    ABCA_ASSERT( i < m_indexHeaders.size(),
+        "Out of range index in ArImpl::getIndexedObjectHeader: " << i );
+
+    return *( m_indexHeaders[i] );
+}
+
+//-*****************************************************************************
+const AbcA::ObjectHeader *
+ArImpl::getIndexedObjectHeader( const std::string &iFullName )
+{
+    readObjectIndex();
+
+    std::map< std::string, std::size_t >::iterator fiter =
+        m_indexMap.find( iFullName );
+    if ( fiter == m_indexMap.end() )
+    {
+        return NULL;
+    }
+
+    return m_indexHeaders[fiter->second].get();
+}
+
 //-*****************************************************************************
 const std::string &ArImpl::getName() const
 {
@@ -194,9 +387,43 @@ ArImpl::getMaxNumSamplesForTimeSamplingIndex( Util::uint32_t iIndex )
 }
 
 //-*****************************************************************************
-StreamIDPtr ArImpl::getStreamID()
+StreamManager & ArImpl::getStreamManager()
+{
+    return m_manager;
+}
+
+//-*****************************************************************************
+AbcA::ReadStats ArImpl::getReadStats()
+{
+    if ( m_stats )
+    {
+        return m_stats->getStats();
+    }
+
+    return AbcA::ReadStats();
+}
+
+//-*****************************************************************************
+void ArImpl::resetReadStats()
+{
+    if ( m_stats )
+    {
+        m_stats->reset();
+    }
+}
+
+//-*****************************************************************************
+bool ArImpl::supportsConcurrentReads()
+{
+    // each read takes a stream of its own, or reads from the mapped file
+    return true;
+}
+
+//-*****************************************************************************
+AbcA::ReadStreamBindingPtr ArImpl::bindReadStream()
 {
-    return m_manager.get();
+    return AbcA::ReadStreamBindingPtr(
+        new ThreadStreamBinding( asArchivePtr() ) );
 }
 
 //-*****************************************************************************
@@ -39,6 +39,7 @@
 
 #include <Alembic/AbcCoreOgawa/Foundation.h>
 #include <Alembic/AbcCoreOgawa/StreamManager.h>
+#include <Alembic/AbcCoreOgawa/ReadStatsCollector.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -56,7 +57,11 @@ private:
     friend struct ReadArchive;
 
     ArImpl( const std::string &iFileName,
-            size_t iNumStreams=1 );
+            size_t iNumStreams=1,
+            bool iUseMMap=false,
+            bool iPreloadHierarchy=false,
+            bool iCollectStats=false,
+            AbcA::ReadTracerPtr iTracer=AbcA::ReadTracerPtr() );
 
     ArImpl( const std::vector< std::istream * > & iStreams );
 
@@ -79,12 +84,13 @@ public:
 
     virtual AbcA::ReadArraySampleCachePtr getReadArraySampleCachePtr()
     {
-        return AbcA::ReadArraySampleCachePtr();
+        return m_readArraySampleCache;
     }
 
     virtual void
     setReadArraySampleCachePtr( AbcA::ReadArraySampleCachePtr iPtr )
     {
+        m_readArraySampleCache = iPtr;
     }
 
     virtual AbcA::index_t getMaxNumSamplesForTimeSamplingIndex(
@@ -100,16 +106,47 @@ public:
         return m_archiveVersion;
     }
 
-    StreamIDPtr getStreamID();
+    virtual AbcA::ObjectReaderPtr findObject( const std::string &iFullName );
+
+    virtual size_t getNumIndexedObjects();
+
+    virtual const AbcA::ObjectHeader & getIndexedObjectHeader( size_t i );
+
+    virtual const AbcA::ObjectHeader *
+    getIndexedObjectHeader( const std::string &iFullName );
+
+    virtual AbcA::ReadStats getReadStats();
+
+    virtual void resetReadStats();
+
+    virtual bool supportsConcurrentReads();
+
+    virtual AbcA::ReadStreamBindingPtr bindReadStream();
+
+    StreamManager & getStreamManager();
+
+    // NULL unless read stats or a tracer were asked for
+    ReadStatsCollector * getReadStatsCollector()
+    {
+        return m_stats.get();
+    }
 
     const std::vector< AbcA::MetaData > & getIndexedMetaData();
 
 private:
     void init();
 
+    void preloadHierarchy( std::size_t iNumThreads );
+
+    // reads the object index the first time it is needed
+    void readObjectIndex();
+
     std::string m_fileName;
     size_t m_numStreams;
 
+    // made before m_archive, since it is handed to it
+    ReadStatsCollectorPtr m_stats;
+
     Ogawa::IArchive m_archive;
 
     Alembic::Util::weak_ptr< AbcA::ObjectReader > m_top;
@@ -125,6 +162,15 @@ private:
     StreamManager m_manager;
 
     std::vector< AbcA::MetaData > m_indexMetaData;
+
+    AbcA::ReadArraySampleCachePtr m_readArraySampleCache;
+
+    // the object index, if the archive was written with one
+    Alembic::Util::mutex m_indexLock;
+    bool m_indexRead;
+    std::vector< ObjectHeaderPtr > m_indexHeaders;
+    std::vector< Util::uint32_t > m_indexChildIndices;
+    std::map< std::string, std::size_t > m_indexMap;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
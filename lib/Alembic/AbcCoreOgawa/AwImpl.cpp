@@ -45,11 +45,16 @@ namespace ALEMBIC_VERSION_NS {
 
 //-*****************************************************************************
 AwImpl::AwImpl( const std::string &iFileName,
-                const AbcA::MetaData &iMetaData )
+                const AbcA::MetaData &iMetaData,
+                bool iIndexObjects,
+                bool iWriteInBackground,
+                std::size_t iBufferSize )
   : m_fileName( iFileName )
   , m_metaData( iMetaData )
-  , m_archive( iFileName )
+  , m_archive( iFileName, iBufferSize, iWriteInBackground )
   , m_metaDataMap( new MetaDataMap() )
+  , m_usesCompression( false )
+  , m_indexObjects( iIndexObjects )
 {
 
     // add default time sampling
@@ -67,10 +72,15 @@ AwImpl::AwImpl( const std::string &iFileName,
 
 //-*****************************************************************************
 AwImpl::AwImpl( std::ostream * iStream,
-                const AbcA::MetaData &iMetaData )
+                const AbcA::MetaData &iMetaData,
+                bool iIndexObjects,
+                bool iWriteInBackground,
+                std::size_t iBufferSize )
   : m_metaData( iMetaData )
-  , m_archive( iStream )
+  , m_archive( iStream, iBufferSize, iWriteInBackground )
   , m_metaDataMap( new MetaDataMap() )
+  , m_usesCompression( false )
+  , m_indexObjects( iIndexObjects )
 {
     // add default time sampling
     AbcA::TimeSamplingPtr ts( new AbcA::TimeSampling() );
@@ -91,8 +101,9 @@ void AwImpl::init()
     // set the version using Ogawa native calls
     // This expresses the AbcCoreOgawa version - how properties,
     // are stored within Ogawa, etc.
-    Util::int32_t version = ALEMBIC_OGAWA_FILE_VERSION;
-    m_archive.getGroup()->addData( 4, &version );
+    // It is bumped by useCompression if need be.
+    Util::int32_t version = 0;
+    m_version = m_archive.getGroup()->addData( 4, &version );
 
     // This is the Alembic library version XXYYZZ
     // Where XX is the major version, YY is the minor version
@@ -211,12 +222,46 @@ void AwImpl::setMaxNumSamplesForTimeSamplingIndex( Util::uint32_t iIndex,
     }
 }
 
+//-*****************************************************************************
+bool AwImpl::supportsConcurrentWrites()
+{
+    // nothing is shared between archives, and samples set on this one
+    // from several threads take turns, see getWriteMutex
+    return true;
+}
+
+//-*****************************************************************************
+void AwImpl::addIndexedObject( ObjectHeaderPtr iHeader,
+                               Util::uint32_t iChildIndex )
+{
+    if ( m_indexObjects )
+    {
+        m_indexHeaders.push_back( iHeader );
+        m_indexChildIndices.push_back( iChildIndex );
+    }
+}
+
+//-*****************************************************************************
+void AwImpl::useCompression()
+{
+    if ( !m_usesCompression )
+    {
+        Util::int32_t version = ALEMBIC_OGAWA_COMPRESSED_FILE_VERSION;
+        m_version->rewrite( 4, &version );
+        m_usesCompression = true;
+    }
+}
+
 //-*****************************************************************************
 AwImpl::~AwImpl()
 {
 
     // empty out the map so any dataset IDs will be freed up
     m_writtenSampleMap.clear();
+    for ( int i = 0; i < kNumDataPrecisions; ++i )
+    {
+        m_compressedWrittenSampleMaps[i].clear();
+    }
 
     // write out our child headers
     if ( m_data )
@@ -247,7 +292,31 @@ AwImpl::~AwImpl()
         }
 
         m_archive.getGroup()->addData( data.size(), &( data.front() ) );
+
+        // every header has been written so the index won't add to the map
+        std::vector< Util::uint8_t > indexData;
+        for ( std::size_t i = 0; i < m_indexHeaders.size(); ++i )
+        {
+            WriteObjectIndexEntry( indexData, *m_indexHeaders[i],
+                                   m_indexChildIndices[i], m_metaDataMap );
+        }
+
         m_metaDataMap->write( m_archive.getGroup() );
+
+        // the index goes after everything older readers expect, so they
+        // don't notice it
+        if ( m_indexObjects )
+        {
+            if ( indexData.empty() )
+            {
+                m_archive.getGroup()->addEmptyData();
+            }
+            else
+            {
+                m_archive.getGroup()->addData( indexData.size(),
+                                               &( indexData.front() ) );
+            }
+        }
     }
 
 }
@@ -57,10 +57,16 @@ private:
     friend struct WriteArchive;
 
     AwImpl( const std::string &iFileName,
-            const AbcA::MetaData &iMetaData );
+            const AbcA::MetaData &iMetaData,
+            bool iIndexObjects=false,
+            bool iWriteInBackground=false,
+            std::size_t iBufferSize=Ogawa::OStream::DEFAULT_BUFFER_SIZE );
 
     AwImpl( std::ostream * iStream,
-            const AbcA::MetaData & iMetaData );
+            const AbcA::MetaData & iMetaData,
+            bool iIndexObjects=false,
+            bool iWriteInBackground=false,
+            std::size_t iBufferSize=Ogawa::OStream::DEFAULT_BUFFER_SIZE );
 
 public:
     virtual ~AwImpl();
@@ -84,6 +90,28 @@ public:
         return m_writtenSampleMap;
     }
 
+    // samples of compressed properties are laid out differently so they
+    // can't be shared with the others, nor with those of another precision
+    WrittenSampleMap &getCompressedWrittenSampleMap( DataPrecision iPrecision )
+    {
+        return m_compressedWrittenSampleMaps[iPrecision];
+    }
+
+    // samples of different properties can be set from different threads,
+    // this keeps them from writing at the same time, since they share the
+    // written sample maps and the previously written sample of a property.
+    // Creating and destroying objects and properties doesn't need it, they
+    // only share the stream with setting samples and Ogawa::OStream appends
+    // and patches in one go.
+    Util::mutex & getWriteMutex()
+    {
+        return m_writeMutex;
+    }
+
+    // called when a compressed property is created, so older readers know
+    // they can't read this archive
+    void useCompression();
+
     MetaDataMapPtr getMetaDataMap()
     {
         return m_metaDataMap;
@@ -102,6 +130,13 @@ public:
     virtual void setMaxNumSamplesForTimeSamplingIndex( Util::uint32_t iIndex,
                                                       AbcA::index_t iMaxIndex );
 
+    virtual bool supportsConcurrentWrites();
+
+    // called for every object as it is created, iChildIndex is where it is
+    // within its parent
+    void addIndexedObject( ObjectHeaderPtr iHeader,
+                           Util::uint32_t iChildIndex );
+
 private:
     void init();
     std::string m_fileName;
@@ -116,7 +151,17 @@ private:
     std::vector < AbcA::index_t > m_maxSamples;
 
     WrittenSampleMap m_writtenSampleMap;
+    WrittenSampleMap m_compressedWrittenSampleMaps[kNumDataPrecisions];
+    Util::mutex m_writeMutex;
     MetaDataMapPtr m_metaDataMap;
+
+    Ogawa::ODataPtr m_version;
+    bool m_usesCompression;
+
+    // the object index, only filled in if asked for
+    bool m_indexObjects;
+    std::vector< ObjectHeaderPtr > m_indexHeaders;
+    std::vector< Util::uint32_t > m_indexChildIndices;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
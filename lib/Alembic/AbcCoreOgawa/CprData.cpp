@@ -46,6 +46,32 @@ namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+namespace {
+
+//-*****************************************************************************
+class PreloadPropertyTask : public Alembic::Util::Task
+{
+public:
+    PreloadPropertyTask( CprDataPtr iData, size_t iIndex,
+                         Alembic::Util::ThreadPool & iPool,
+                         ArImpl & iArchive )
+        : m_data( iData ), m_index( iIndex ), m_pool( iPool )
+        , m_archive( iArchive ) {}
+
+    virtual void run()
+    {
+        m_data->preloadProperty( m_index, m_pool, m_archive );
+    }
+
+private:
+    CprDataPtr m_data;
+    size_t m_index;
+    Alembic::Util::ThreadPool & m_pool;
+    ArImpl & m_archive;
+};
+
+} // End anonymous namespace
+
 //-*****************************************************************************
 CprData::CprData( Ogawa::IGroupPtr iGroup,
                   std::size_t iThreadId,
@@ -138,12 +164,12 @@ CprData::getScalarProperty( AbcA::CompoundPropertyReaderPtr iParent,
     AbcA::BasePropertyReaderPtr bptr = sub.made.lock();
     if ( ! bptr )
     {
-        StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
-        AbcA::ArchiveReader > (
-            iParent->getObject()->getArchive() )->getStreamID();
+        StreamID streamId( Alembic::Util::dynamic_pointer_cast< ArImpl,
+            AbcA::ArchiveReader > (
+                iParent->getObject()->getArchive() )->getStreamManager() );
 
         Ogawa::IGroupPtr group = m_group->getGroup( fiter->second, true,
-                                                    streamId->getID() );
+                                                    streamId.getID() );
 
         ABCA_ASSERT( group, "Scalar Property not backed by a valid group.");
 
@@ -183,12 +209,12 @@ CprData::getArrayProperty( AbcA::CompoundPropertyReaderPtr iParent,
     AbcA::BasePropertyReaderPtr bptr = sub.made.lock();
     if ( ! bptr )
     {
-        StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
-        AbcA::ArchiveReader > (
-            iParent->getObject()->getArchive() )->getStreamID();
+        StreamID streamId( Alembic::Util::dynamic_pointer_cast< ArImpl,
+            AbcA::ArchiveReader > (
+                iParent->getObject()->getArchive() )->getStreamManager() );
 
         Ogawa::IGroupPtr group = m_group->getGroup( fiter->second, true,
-                                                    streamId->getID() );
+                                                    streamId.getID() );
 
         ABCA_ASSERT( group, "Array Property not backed by a valid group.");
 
@@ -227,22 +253,27 @@ CprData::getCompoundProperty( AbcA::CompoundPropertyReaderPtr iParent,
     }
 
     AbcA::BasePropertyReaderPtr bptr = sub.made.lock();
-    if ( ! bptr )
+    if ( ! bptr && sub.data )
+    {
+        bptr.reset( new CprImpl( iParent, sub.header, sub.data ) );
+        sub.made = bptr;
+    }
+    else if ( ! bptr )
     {
         Alembic::Util::shared_ptr<  ArImpl > implPtr =
             Alembic::Util::dynamic_pointer_cast< ArImpl, AbcA::ArchiveReader > (
                 iParent->getObject()->getArchive() );
 
-        StreamIDPtr streamId = implPtr->getStreamID();
+        StreamID streamId( implPtr->getStreamManager() );
 
         Ogawa::IGroupPtr group = m_group->getGroup( fiter->second, false,
-                                                    streamId->getID() );
+                                                    streamId.getID() );
 
         ABCA_ASSERT( group, "Compound Property not backed by a valid group.");
 
         // Make a new one.
         bptr.reset( new CprImpl( iParent, group, sub.header,
-                                 streamId->getID(),
+                                 streamId.getID(),
                                  implPtr->getIndexedMetaData() ) );
 
         sub.made = bptr;
@@ -254,6 +285,42 @@ CprData::getCompoundProperty( AbcA::CompoundPropertyReaderPtr iParent,
     return ret;
 }
 
+//-*****************************************************************************
+void CprData::preload( Alembic::Util::ThreadPool & iPool, ArImpl & iArchive )
+{
+    for ( size_t i = 0; i < m_propertyHeaders.size(); ++i )
+    {
+        if ( m_propertyHeaders[i].header->header.isCompound() )
+        {
+            iPool.add( Alembic::Util::TaskPtr( new PreloadPropertyTask(
+                shared_from_this(), i, iPool, iArchive ) ) );
+        }
+    }
+}
+
+//-*****************************************************************************
+void CprData::preloadProperty( size_t i, Alembic::Util::ThreadPool & iPool,
+                               ArImpl & iArchive )
+{
+    ABCA_ASSERT( i < m_propertyHeaders.size(),
+        "Out of range index in CprData::preloadProperty: " << i );
+
+    CprDataPtr data;
+    {
+        StreamID streamId( iArchive.getStreamManager() );
+        Ogawa::IGroupPtr group = m_group->getGroup( i, false,
+                                                    streamId.getID() );
+
+        ABCA_ASSERT( group, "Compound Property not backed by a valid group.");
+
+        data.reset( new CprData( group, streamId.getID(), iArchive,
+                                 iArchive.getIndexedMetaData() ) );
+    }
+
+    m_propertyHeaders[i].data = data;
+    data->preload( iPool, iArchive );
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreOgawa
 } // End namespace Alembic
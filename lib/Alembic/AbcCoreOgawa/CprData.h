@@ -43,6 +43,8 @@ namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+class ArImpl;
+
 // data class owned by CprImpl, or OrImpl if it is a "top" object
 // it owns and makes child properties
 class CprData : public Alembic::Util::enable_shared_from_this<CprData>
@@ -77,6 +79,15 @@ public:
     getCompoundProperty( AbcA::CompoundPropertyReaderPtr iParent,
                          const std::string &iName );
 
+    // Adds tasks to iPool which read the data for every compound property
+    // below this one, see OrData::preload.
+    void preload( Alembic::Util::ThreadPool & iPool, ArImpl & iArchive );
+
+    // Reads the data for property i, and preloads it, called by preload's
+    // tasks
+    void preloadProperty( size_t i, Alembic::Util::ThreadPool & iPool,
+                          ArImpl & iArchive );
+
 private:
     Ogawa::IGroupPtr m_group;
 
@@ -85,6 +96,9 @@ private:
     {
         PropertyHeaderPtr header;
         WeakBprPtr made;
+
+        // set for compound properties whose data was read by preload
+        Alembic::Util::shared_ptr< CprData > data;
     };
 
     typedef std::map<std::string, size_t> SubPropertiesMap;
@@ -35,11 +35,30 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreOgawa/CprImpl.h>
+#include <Alembic/AbcCoreOgawa/ArImpl.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+namespace {
+
+//-*****************************************************************************
+// counts a compound property reader, if iObject's archive is counting
+void countProperty( AbcA::ObjectReaderPtr iObject,
+                    const AbcA::PropertyHeader &iHeader )
+{
+    ArImpl * archive = dynamic_cast< ArImpl * >(
+        iObject->getArchive().get() );
+
+    if ( archive && archive->getReadStatsCollector() )
+    {
+        archive->getReadStatsCollector()->property( iHeader );
+    }
+}
+
+} // End anonymous namespace
+
 //-*****************************************************************************
 //-*****************************************************************************
 // CLASS
@@ -72,6 +91,27 @@ CprImpl::CprImpl( AbcA::CompoundPropertyReaderPtr iParent,
 
     m_data.reset( new CprData( iGroup, iThreadId, *( m_object->getArchive() ),
                                iIndexedMetaData ) );
+
+    countProperty( m_object, m_header->header );
+}
+
+//-*****************************************************************************
+CprImpl::CprImpl( AbcA::CompoundPropertyReaderPtr iParent,
+                  PropertyHeaderPtr iHeader,
+                  CprDataPtr iData )
+    : m_parent( iParent )
+    , m_header( iHeader )
+    , m_data( iData )
+{
+    ABCA_ASSERT( m_parent, "Invalid parent in CprImpl(Compound)" );
+    ABCA_ASSERT( m_header, "invalid header in CprImpl(Compound)" );
+    ABCA_ASSERT( m_data, "Invalid data in CprImpl(Compound)" );
+
+    AbcA::ObjectReaderPtr optr = m_parent->getObject();
+    ABCA_ASSERT( optr, "Invalid object in CprImpl::CprImpl(Compound)" );
+    m_object = optr;
+
+    countProperty( m_object, m_header->header );
 }
 
 //-*****************************************************************************
@@ -58,6 +58,12 @@ public:
              std::size_t iThreadId,
              const std::vector< AbcA::MetaData > & iIndexedMetaData );
 
+    // For construction from a compound property reader, with data that
+    // has already been read, see CprData::preload
+    CprImpl( AbcA::CompoundPropertyReaderPtr iParent,
+             PropertyHeaderPtr iHeader,
+             CprDataPtr iData );
+
     CprImpl( AbcA::ObjectReaderPtr iParent,
              CprDataPtr iData );
 
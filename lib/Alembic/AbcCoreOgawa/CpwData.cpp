@@ -173,9 +173,33 @@ CpwData::createArrayProperty( AbcA::CompoundPropertyWriterPtr iParent,
     PropertyHeaderPtr headerPtr( new PropertyHeaderAndFriends( iName,
         AbcA::kArrayProperty, iMetaData, iDataType, ts, iTimeSamplingIndex ) );
 
+    // arrays can ask for samples to be written as what changed since the
+    // previous one, which is written the way compressed samples are
+    Util::uint32_t deltaInterval = 0;
+    if ( iDataType.getPod() != Alembic::Util::kStringPOD &&
+         iDataType.getPod() != Alembic::Util::kWstringPOD )
+    {
+        const std::string val = iMetaData.get( "deltaInterval" );
+        int interval = atoi( val.c_str() );
+        if ( interval > 1 )
+        {
+            deltaInterval = ( Util::uint32_t ) interval;
+        }
+    }
+
+    // the compression hint decides whether the samples get compressed
+    AbcA::ArchiveWriterPtr archive = iParent->getObject()->getArchive();
+    Util::int8_t compressionLevel = archive->getCompressionHint();
+    if ( compressionLevel >= 0 || deltaInterval > 0 )
+    {
+        headerPtr->isCompressed = true;
+        UseCompression( archive );
+    }
+
     AbcA::ArrayPropertyWriterPtr
         ret( new ApwImpl( iParent, m_group->addGroup(), headerPtr,
-                          m_propertyHeaders.size() ) );
+                          m_propertyHeaders.size(), compressionLevel,
+                          deltaInterval ) );
 
     m_propertyHeaders.push_back( headerPtr );
     m_madeProperties[iName] = WeakBpwPtr( ret );
@@ -225,6 +249,7 @@ void CpwData::writePropertyHeaders( MetaDataMapPtr iMetaDataMap )
                            prop->header,
                            prop->isScalarLike,
                            prop->isHomogenous,
+                           prop->isCompressed,
                            prop->timeSamplingIndex,
                            prop->nextSampleIndex,
                            prop->firstChangedIndex,
@@ -54,7 +54,11 @@
 #include <assert.h>
 #include <string.h>
 
-#define ALEMBIC_OGAWA_FILE_VERSION 0
+// The newest file version that can be read.  Archives are written with the
+// oldest version that describes what is in them, version 1 archives have
+// compressed array samples which older readers would misread.
+#define ALEMBIC_OGAWA_FILE_VERSION 1
+#define ALEMBIC_OGAWA_COMPRESSED_FILE_VERSION 1
 
 //-*****************************************************************************
 
@@ -82,6 +86,7 @@ struct PropertyHeaderAndFriends
     {
         isScalarLike = true;
         isHomogenous = true;
+        isCompressed = false;
         nextSampleIndex = 0;
         firstChangedIndex = 0;
         lastChangedIndex = 0;
@@ -95,6 +100,7 @@ struct PropertyHeaderAndFriends
     {
         isScalarLike = true;
         isHomogenous = true;
+        isCompressed = false;
         nextSampleIndex = 0;
         firstChangedIndex = 0;
         lastChangedIndex = 0;
@@ -113,6 +119,7 @@ struct PropertyHeaderAndFriends
     {
         isScalarLike = true;
         isHomogenous = true;
+        isCompressed = false;
         nextSampleIndex = 0;
         firstChangedIndex = 0;
         lastChangedIndex = 0;
@@ -154,6 +161,12 @@ struct PropertyHeaderAndFriends
 
     bool isHomogenous;
 
+    // Samples of compressed array properties are written as the key, the
+    // number of uncompressed bytes (8 bytes), how they were encoded
+    // (1 byte, see DataEncoding) and then the encoded bytes.  Delta samples
+    // have the number of changed points (4 bytes) before the encoded bytes.
+    bool isCompressed;
+
     // Index of the next sample to write
     Util::uint32_t nextSampleIndex;
 
@@ -169,6 +182,53 @@ struct PropertyHeaderAndFriends
     Util::uint32_t timeSamplingIndex;
 };
 
+//-*****************************************************************************
+// How the samples of a compressed array property are encoded, stored in the
+// low 4 bits of the encoding byte
+enum DataEncoding
+{
+    // as is, too small or not worth compressing
+    kStoredEncoding = 0,
+
+    // zlib compressed
+    kZlibEncoding = 1,
+
+    // the bytes of each POD are grouped by significance before being zlib
+    // compressed, which suits floats
+    kShuffledZlibEncoding = 2,
+
+    // or'd with one of the above for samples which only hold the points that
+    // changed since the previous sample: the index of each of those points
+    // (as uint32s) followed by their values.  Samples without it are
+    // keyframes.
+    //
+    // Array properties ask for it with the "deltaInterval" metadata, how
+    // many samples there can be from one keyframe to the next, see
+    // Abc::SetDeltaInterval.
+    kDeltaEncoding = 8
+};
+
+//-*****************************************************************************
+// How the float32 samples of a compressed array property were reduced before
+// being encoded, stored in the high 4 bits of the encoding byte.  The
+// uncompressed size is always that of the float32 data.
+//
+// Array properties ask for it with AbcA::ArrayPropertyWriter::setPrecision.
+enum DataPrecision
+{
+    // the floats as is
+    kFullPrecision = 0,
+
+    // every float as a float16
+    kHalfPrecision = 1,
+
+    // the minimum and maximum of each component of the sample as floats,
+    // followed by every float as a uint16 between those
+    kQuantizedPrecision = 2,
+
+    kNumDataPrecisions
+};
+
 typedef Alembic::Util::shared_ptr<PropertyHeaderAndFriends> PropertyHeaderPtr;
 typedef std::vector<PropertyHeaderPtr> PropertyHeaderPtrs;
 
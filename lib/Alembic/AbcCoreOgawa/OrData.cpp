@@ -44,6 +44,31 @@ namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+namespace {
+
+//-*****************************************************************************
+class PreloadChildTask : public Alembic::Util::Task
+{
+public:
+    PreloadChildTask( OrDataPtr iData, size_t iIndex,
+                      Alembic::Util::ThreadPool & iPool, ArImpl & iArchive )
+        : m_data( iData ), m_index( iIndex ), m_pool( iPool )
+        , m_archive( iArchive ) {}
+
+    virtual void run()
+    {
+        m_data->preloadChild( m_index, m_pool, m_archive );
+    }
+
+private:
+    OrDataPtr m_data;
+    size_t m_index;
+    Alembic::Util::ThreadPool & m_pool;
+    ArImpl & m_archive;
+};
+
+} // End anonymous namespace
+
 //-*****************************************************************************
 OrData::OrData( Ogawa::IGroupPtr iGroup,
                 const std::string & iParentName,
@@ -150,7 +175,13 @@ OrData::getChild( AbcA::ObjectReaderPtr iParent, size_t i )
         "Out of range index in OrData::getChild: " << i );
 
     AbcA::ObjectReaderPtr optr = m_children[i].made.lock();
-    if ( ! optr )
+    if ( ! optr && m_children[i].data )
+    {
+        optr.reset ( new OrImpl( iParent, m_children[i].data,
+                                 m_children[i].header ) );
+        m_children[i].made = optr;
+    }
+    else if ( ! optr )
     {
         // Make a new one.
         optr.reset ( new OrImpl( iParent, m_group, i + 1,
@@ -160,6 +191,45 @@ OrData::getChild( AbcA::ObjectReaderPtr iParent, size_t i )
     return optr;
 }
 
+//-*****************************************************************************
+void OrData::preload( Alembic::Util::ThreadPool & iPool, ArImpl & iArchive )
+{
+    if ( m_data )
+    {
+        m_data->preload( iPool, iArchive );
+    }
+
+    // every child gets its own task, which adds tasks for its children, so
+    // the pool's threads stay busy however lopsided the hierarchy is
+    for ( size_t i = 0; i < m_children.size(); ++i )
+    {
+        iPool.add( Alembic::Util::TaskPtr(
+            new PreloadChildTask( shared_from_this(), i, iPool, iArchive ) ) );
+    }
+}
+
+//-*****************************************************************************
+void OrData::preloadChild( size_t i, Alembic::Util::ThreadPool & iPool,
+                           ArImpl & iArchive )
+{
+    ABCA_ASSERT( i < m_children.size(),
+        "Out of range index in OrData::preloadChild: " << i );
+
+    OrDataPtr data;
+    {
+        StreamID streamId( iArchive.getStreamManager() );
+        std::size_t id = streamId.getID();
+        Ogawa::IGroupPtr group = m_group->getGroup( i + 1, false, id );
+        data.reset( new OrData( group, m_children[i].header->getFullName(),
+                                id, iArchive,
+                                iArchive.getIndexedMetaData() ) );
+    }
+
+    m_children[i].data = data;
+    data->preload( iPool, iArchive );
+}
+
+//-*****************************************************************************
 void OrData::getPropertiesHash( Util::Digest & oDigest, size_t iThreadId )
 {
     std::size_t numChildren = m_group->getNumChildren();
@@ -43,6 +43,7 @@ namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+class ArImpl;
 class CprData;
 
 // data class owned by OrImpl, or ArImpl if it is a "top" object.
@@ -80,6 +81,15 @@ public:
 
     void getChildrenHash( Util::Digest & oDigest, size_t iThreadId );
 
+    // Adds tasks to iPool which read the data for every object and compound
+    // property below this one, so that they don't have to be read when
+    // they are asked for.  Nothing else may use this until iPool is done.
+    void preload( Alembic::Util::ThreadPool & iPool, ArImpl & iArchive );
+
+    // Reads the data for child i, and preloads it, called by preload's tasks
+    void preloadChild( size_t i, Alembic::Util::ThreadPool & iPool,
+                       ArImpl & iArchive );
+
 private:
 
     Ogawa::IGroupPtr m_group;
@@ -88,6 +98,9 @@ private:
     {
         ObjectHeaderPtr header;
         WeakOrPtr made;
+
+        // set if the data was read by preload
+        Alembic::Util::shared_ptr< OrData > data;
     };
 
     typedef std::map<std::string, size_t> ChildrenMap;
@@ -65,11 +65,40 @@ OrImpl::OrImpl( AbcA::ObjectReaderPtr iParent,
     m_archive = m_parent->getArchiveImpl();
     ABCA_ASSERT( m_archive, "Invalid archive in OrImpl(Object)" );
 
-    StreamIDPtr streamId = m_archive->getStreamID();
-    std::size_t id = streamId->getID();
+    StreamID streamId( m_archive->getStreamManager() );
+    std::size_t id = streamId.getID();
     Ogawa::IGroupPtr group = iParentGroup->getGroup( iGroupIndex, false, id );
     m_data.reset( new OrData( group, iHeader->getFullName(), id,
         *m_archive, m_archive->getIndexedMetaData() ) );
+
+    if ( m_archive->getReadStatsCollector() )
+    {
+        m_archive->getReadStatsCollector()->object( *m_header );
+    }
+}
+
+//-*****************************************************************************
+// Reading as a child of a parent, with data that has already been read.
+OrImpl::OrImpl( AbcA::ObjectReaderPtr iParent,
+                OrDataPtr iData,
+                ObjectHeaderPtr iHeader )
+    : m_data( iData )
+    , m_header( iHeader )
+{
+    m_parent = Alembic::Util::dynamic_pointer_cast< OrImpl,
+        AbcA::ObjectReader > (iParent);
+
+    ABCA_ASSERT( m_parent, "Invalid parent in OrImpl(Object)" );
+    ABCA_ASSERT( m_data, "Invalid data in OrImpl(Object)" );
+    ABCA_ASSERT( m_header, "Invalid header in OrImpl(Object)" );
+
+    m_archive = m_parent->getArchiveImpl();
+    ABCA_ASSERT( m_archive, "Invalid archive in OrImpl(Object)" );
+
+    if ( m_archive->getReadStatsCollector() )
+    {
+        m_archive->getReadStatsCollector()->object( *m_header );
+    }
 }
 
 //-*****************************************************************************
@@ -84,6 +113,11 @@ OrImpl::OrImpl( Alembic::Util::shared_ptr< ArImpl > iArchive,
     ABCA_ASSERT( m_archive, "Invalid archive in OrImpl(Archive)" );
     ABCA_ASSERT( m_data, "Invalid data in OrImpl(Archive)" );
     ABCA_ASSERT( m_header, "Invalid header in OrImpl(Archive)" );
+
+    if ( m_archive->getReadStatsCollector() )
+    {
+        m_archive->getReadStatsCollector()->object( *m_header );
+    }
 }
 
 //-*****************************************************************************
@@ -107,6 +141,15 @@ AbcA::ArchiveReaderPtr OrImpl::getArchive()
 //-*****************************************************************************
 AbcA::ObjectReaderPtr OrImpl::getParent()
 {
+    // objects made by ArImpl::findObject don't hold onto their parent, so
+    // find it when it is asked for
+    if ( !m_parent && m_header->getFullName() != "/" )
+    {
+        const std::string & fullName = m_header->getFullName();
+        return m_archive->findObject(
+            fullName.substr( 0, fullName.rfind( '/' ) ) );
+    }
+
     return m_parent;
 }
 
@@ -154,8 +197,8 @@ AbcA::ObjectReaderPtr OrImpl::asObjectPtr()
 //-*****************************************************************************
 bool OrImpl::getPropertiesHash( Util::Digest & oDigest )
 {
-    StreamIDPtr streamId = m_archive->getStreamID();
-    std::size_t id = streamId->getID();
+    StreamID streamId( m_archive->getStreamManager() );
+    std::size_t id = streamId.getID();
     m_data->getPropertiesHash( oDigest, id );
     return true;
 }
@@ -163,8 +206,8 @@ bool OrImpl::getPropertiesHash( Util::Digest & oDigest )
 //-*****************************************************************************
 bool OrImpl::getChildrenHash( Util::Digest & oDigest )
 {
-    StreamIDPtr streamId = m_archive->getStreamID();
-    std::size_t id = streamId->getID();
+    StreamID streamId( m_archive->getStreamManager() );
+    std::size_t id = streamId.getID();
     m_data->getChildrenHash( oDigest, id );
     return true;
 }
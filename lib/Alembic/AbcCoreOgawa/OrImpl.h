@@ -53,6 +53,7 @@ class OrImpl
 
 public:
 
+    // for the top object, or one found by ArImpl::findObject
     OrImpl( Alembic::Util::shared_ptr< ArImpl > iArchive,
             OrDataPtr iData,
             ObjectHeaderPtr iHeader );
@@ -62,6 +63,11 @@ public:
             std::size_t iIndex,
             ObjectHeaderPtr iHeader );
 
+    // for a child whose data was already read, see OrData::preload
+    OrImpl( AbcA::ObjectReaderPtr iParent,
+            OrDataPtr iData,
+            ObjectHeaderPtr iHeader );
+
     virtual ~OrImpl();
 
     //-*************************************************************************
@@ -71,6 +71,9 @@ OwImpl::OwImpl( AbcA::ObjectWriterPtr iParent,
     ABCA_ASSERT( m_archive, "Invalid archive" );
 
     m_data.reset( new OwData( iGroup ) );
+
+    Alembic::Util::dynamic_pointer_cast< AwImpl, AbcA::ArchiveWriter >(
+        m_archive )->addIndexedObject( m_header, m_index );
 }
 
 //-*****************************************************************************
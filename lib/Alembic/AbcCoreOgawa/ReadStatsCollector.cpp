@@ -0,0 +1,164 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreOgawa/ReadStatsCollector.h>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+ReadStatsCollector::ReadStatsCollector( bool iCount,
+                                        AbcA::ReadTracerPtr iTracer )
+  : m_count( iCount )
+  , m_tracer( iTracer )
+{
+}
+
+//-*****************************************************************************
+void ReadStatsCollector::read( std::size_t iThreadId, Util::uint64_t iPos,
+                               Util::uint64_t iSize, double iLockWait,
+                               bool iSeeked )
+{
+    if ( m_count )
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        m_stats.numReads ++;
+        m_stats.numBytesRead += iSize;
+        m_stats.lockWaitTime += iLockWait;
+        if ( iSeeked )
+        {
+            m_stats.numSeeks ++;
+        }
+    }
+
+    if ( m_tracer )
+    {
+        m_tracer->read( iPos, iSize, iThreadId, iLockWait );
+    }
+}
+
+//-*****************************************************************************
+void ReadStatsCollector::group( Util::uint64_t iPos,
+                                Util::uint64_t iNumChildren )
+{
+    if ( m_count )
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        m_stats.numGroups ++;
+    }
+}
+
+//-*****************************************************************************
+void ReadStatsCollector::data( Util::uint64_t iPos, Util::uint64_t iSize )
+{
+    if ( m_count )
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        m_stats.numData ++;
+    }
+}
+
+//-*****************************************************************************
+void ReadStatsCollector::object( const AbcA::ObjectHeader &iHeader )
+{
+    if ( m_count )
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        m_stats.numObjects ++;
+    }
+
+    if ( m_tracer )
+    {
+        m_tracer->object( iHeader );
+    }
+}
+
+//-*****************************************************************************
+void ReadStatsCollector::property( const AbcA::PropertyHeader &iHeader )
+{
+    if ( m_count )
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        m_stats.numProperties ++;
+    }
+
+    if ( m_tracer )
+    {
+        m_tracer->property( iHeader );
+    }
+}
+
+//-*****************************************************************************
+void ReadStatsCollector::cacheLookup( const AbcA::ArraySampleKey &iKey,
+                                      bool iFound )
+{
+    if ( m_count )
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        if ( iFound )
+        {
+            m_stats.numCacheHits ++;
+        }
+        else
+        {
+            m_stats.numCacheMisses ++;
+        }
+    }
+
+    if ( m_tracer )
+    {
+        m_tracer->cacheLookup( iKey, iFound );
+    }
+}
+
+//-*****************************************************************************
+AbcA::ReadStats ReadStatsCollector::getStats()
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    return m_stats;
+}
+
+//-*****************************************************************************
+void ReadStatsCollector::reset()
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    m_stats = AbcA::ReadStats();
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
@@ -0,0 +1,89 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_AbcCoreOgawa_ReadStatsCollector_h_
+#define _Alembic_AbcCoreOgawa_ReadStatsCollector_h_
+
+#include <Alembic/AbcCoreOgawa/Foundation.h>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+// Counts what an archive reads, and hands it on to a tracer.  One of these
+// only exists for archives which were asked for either when opened.
+class ReadStatsCollector : public Ogawa::IStreamsObserver
+{
+public:
+    ReadStatsCollector( bool iCount, AbcA::ReadTracerPtr iTracer );
+
+    virtual void read( std::size_t iThreadId, Util::uint64_t iPos,
+                       Util::uint64_t iSize, double iLockWait,
+                       bool iSeeked );
+
+    virtual void group( Util::uint64_t iPos, Util::uint64_t iNumChildren );
+
+    virtual void data( Util::uint64_t iPos, Util::uint64_t iSize );
+
+    void object( const AbcA::ObjectHeader &iHeader );
+
+    void property( const AbcA::PropertyHeader &iHeader );
+
+    void cacheLookup( const AbcA::ArraySampleKey &iKey, bool iFound );
+
+    AbcA::ReadStats getStats();
+
+    void reset();
+
+private:
+    bool m_count;
+    AbcA::ReadTracerPtr m_tracer;
+
+    Alembic::Util::mutex m_lock;
+    AbcA::ReadStats m_stats;
+};
+
+typedef Alembic::Util::shared_ptr< ReadStatsCollector > ReadStatsCollectorPtr;
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
+
+#endif
@@ -37,17 +37,295 @@
 #include <Alembic/AbcCoreOgawa/ReadUtil.h>
 #include <halfLimits.h>
 
+#include <zlib.h>
+
 namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+namespace {
+
+// the key, the uncompressed size and the encoding
+const std::size_t COMPRESSED_HEADER_SIZE = 25;
+
+//-*****************************************************************************
+// turns the reduced floats of a sample back into iNumFloats floats in oBuf,
+// see DataPrecision
+void restorePrecision( const std::vector< char > & iReduced,
+                       Util::uint8_t iPrecision,
+                       std::size_t iNumFloats,
+                       std::vector< char > & oBuf )
+{
+    float * floats = reinterpret_cast< float * >( &oBuf.front() );
+
+    if ( iPrecision == kHalfPrecision )
+    {
+        const Util::float16_t * halfs =
+            reinterpret_cast< const Util::float16_t * >( &iReduced.front() );
+        for ( std::size_t i = 0; i < iNumFloats; ++i )
+        {
+            floats[i] = halfs[i];
+        }
+        return;
+    }
+
+    std::size_t boundsSize = iReduced.size() -
+        iNumFloats * sizeof( Util::uint16_t );
+    std::size_t extent = boundsSize / ( 2 * sizeof( float ) );
+    const float * bounds =
+        reinterpret_cast< const float * >( &iReduced.front() );
+    const Util::uint16_t * quantized =
+        reinterpret_cast< const Util::uint16_t * >( &iReduced[boundsSize] );
+
+    for ( std::size_t i = 0; i < iNumFloats; ++i )
+    {
+        std::size_t c = i % extent;
+        double range = ( double ) bounds[extent + c] - bounds[c];
+        floats[i] = ( float )( bounds[c] + quantized[i] * range / 65535.0 );
+    }
+}
+
+//-*****************************************************************************
+// whether the sample of a compressed property only holds what changed since
+// the sample before it
+bool isDeltaData( Ogawa::IDataPtr iData, size_t iThreadId )
+{
+    if ( iData->getSize() < COMPRESSED_HEADER_SIZE )
+    {
+        return false;
+    }
+
+    Util::uint8_t encoding = 0;
+    iData->read( 1, &encoding, COMPRESSED_HEADER_SIZE - 1, iThreadId );
+    return ( encoding & kDeltaEncoding ) != 0;
+}
+
+//-*****************************************************************************
+// decodes the encoded bytes of the sample of a compressed property into oBuf,
+// for delta samples those are the changed points instead of the sample.
+// iExtent is only needed for samples with reduced precision.
+void decodeData( Ogawa::IDataPtr iData,
+                 size_t iThreadId,
+                 std::size_t iPodSize,
+                 std::size_t iExtent,
+                 std::vector< char > & oBuf )
+{
+    std::size_t dataSize = iData->getSize();
+    ABCA_ASSERT( dataSize >= COMPRESSED_HEADER_SIZE,
+        "Incorrect compressed data, expected a key, size and encoding" );
+
+    char header[COMPRESSED_HEADER_SIZE];
+    iData->read( COMPRESSED_HEADER_SIZE, header, 0, iThreadId );
+
+    Util::uint64_t numBytes = *( ( Util::uint64_t * )( &header[16] ) );
+    Util::uint8_t encoding = header[24] & 0x07;
+    bool isDelta = ( header[24] & kDeltaEncoding ) != 0;
+    Util::uint8_t precision = ( Util::uint8_t )( header[24] ) >> 4;
+    std::size_t encodedPos = COMPRESSED_HEADER_SIZE;
+
+    ABCA_ASSERT( encoding == kStoredEncoding ||
+                 encoding == kZlibEncoding ||
+                 encoding == kShuffledZlibEncoding,
+                 "Unknown compressed data encoding: " << ( int ) encoding );
+
+    // how many bytes the encoding holds
+    std::size_t reducedSize = numBytes;
+    std::size_t numFloats = numBytes / sizeof( float );
+    if ( isDelta )
+    {
+        ABCA_ASSERT( precision == kFullPrecision &&
+                     dataSize >= COMPRESSED_HEADER_SIZE + 4,
+                     "Incorrect delta data" );
+
+        Util::uint32_t numChanged = 0;
+        iData->read( 4, &numChanged, COMPRESSED_HEADER_SIZE, iThreadId );
+        encodedPos += 4;
+
+        reducedSize = ( std::size_t ) numChanged *
+            ( sizeof( Util::uint32_t ) + iPodSize * iExtent );
+    }
+    else if ( precision == kHalfPrecision )
+    {
+        reducedSize = numFloats * sizeof( Util::float16_t );
+    }
+    else if ( precision == kQuantizedPrecision )
+    {
+        ABCA_ASSERT( iExtent > 0, "Quantized data needs an extent" );
+        reducedSize = iExtent * 2 * sizeof( float ) +
+            numFloats * sizeof( Util::uint16_t );
+    }
+    else
+    {
+        ABCA_ASSERT( precision == kFullPrecision,
+            "Unknown compressed data precision: " << ( int ) precision );
+    }
+
+    std::size_t encodedSize = dataSize - encodedPos;
+
+    std::vector< char > reduced;
+    std::vector< char > & decoded =
+        precision == kFullPrecision ? oBuf : reduced;
+    if ( precision != kFullPrecision )
+    {
+        iPodSize = sizeof( Util::uint16_t );
+        oBuf.resize( numBytes );
+    }
+    else if ( isDelta )
+    {
+        // the indices and most values are 4 bytes, see WriteDeltaData
+        iPodSize = sizeof( Util::uint32_t );
+    }
+
+    decoded.resize( reducedSize );
+    if ( encoding == kStoredEncoding )
+    {
+        ABCA_ASSERT( encodedSize == reducedSize,
+            "Incorrect compressed data, unexpected size" );
+
+        if ( reducedSize > 0 )
+        {
+            iData->read( reducedSize, &decoded.front(), encodedPos,
+                         iThreadId );
+        }
+    }
+    else
+    {
+        std::vector< char > encoded( encodedSize );
+        iData->read( encodedSize, &encoded.front(), encodedPos, iThreadId );
+
+        std::vector< char > shuffled;
+        std::vector< char > & into =
+            encoding == kShuffledZlibEncoding ? shuffled : decoded;
+        into.resize( reducedSize );
+
+        uLongf uncompressedSize = reducedSize;
+        ABCA_ASSERT( uncompress( ( Bytef * ) &into.front(), &uncompressedSize,
+                                 ( const Bytef * ) &encoded.front(),
+                                 encodedSize ) == Z_OK &&
+                     uncompressedSize == reducedSize,
+                     "Could not decompress data" );
+
+        // put the bytes of each POD back together
+        if ( encoding == kShuffledZlibEncoding )
+        {
+            std::size_t numPods = reducedSize / iPodSize;
+            for ( std::size_t i = 0; i < numPods; ++i )
+            {
+                for ( std::size_t b = 0; b < iPodSize; ++b )
+                {
+                    decoded[ i * iPodSize + b ] = shuffled[ b * numPods + i ];
+                }
+            }
+        }
+    }
+
+    if ( precision != kFullPrecision && numFloats > 0 )
+    {
+        restorePrecision( reduced, precision, numFloats, oBuf );
+    }
+}
+
+//-*****************************************************************************
+// decodes the sample of a compressed property into oBuf.  If it is a delta
+// sample the keyframe before it is decoded and then every delta after that
+// up to this one is applied, iGroup and iIndex are where iData is.
+void decompressData( Ogawa::IDataPtr iData,
+                     size_t iThreadId,
+                     std::size_t iPodSize,
+                     std::size_t iExtent,
+                     std::vector< char > & oBuf,
+                     Ogawa::IGroupPtr iGroup,
+                     std::size_t iIndex )
+{
+    if ( !isDeltaData( iData, iThreadId ) )
+    {
+        decodeData( iData, iThreadId, iPodSize, iExtent, oBuf );
+        return;
+    }
+
+    ABCA_ASSERT( iGroup, "Can't read delta data without its keyframe" );
+
+    // the data and dimensions of each sample are next to each other
+    std::size_t keyIndex = iIndex;
+    do
+    {
+        ABCA_ASSERT( keyIndex >= 2, "Delta data without a keyframe" );
+        keyIndex -= 2;
+    }
+    while ( isDeltaData( iGroup->getData( keyIndex, iThreadId ),
+                         iThreadId ) );
+
+    decodeData( iGroup->getData( keyIndex, iThreadId ), iThreadId, iPodSize,
+                iExtent, oBuf );
+
+    std::size_t pointBytes = iPodSize * iExtent;
+    std::size_t numPoints = oBuf.size() / pointBytes;
+    std::vector< char > changes;
+    for ( std::size_t i = keyIndex + 2; i <= iIndex; i += 2 )
+    {
+        Ogawa::IDataPtr data =
+            i == iIndex ? iData : iGroup->getData( i, iThreadId );
+        decodeData( data, iThreadId, iPodSize, iExtent, changes );
+
+        ABCA_ASSERT( ReadDataSize( data, iThreadId, true ) == oBuf.size(),
+            "Incorrect delta data, its size doesn't match its keyframe" );
+
+        std::size_t numChanged = changes.size() /
+            ( sizeof( Util::uint32_t ) + pointBytes );
+        if ( numChanged == 0 )
+        {
+            continue;
+        }
+
+        const Util::uint32_t * indices =
+            reinterpret_cast< const Util::uint32_t * >( &changes.front() );
+        const char * values = &changes[numChanged * sizeof( Util::uint32_t )];
+        for ( std::size_t j = 0; j < numChanged; ++j )
+        {
+            ABCA_ASSERT( indices[j] < numPoints,
+                "Incorrect delta data, point out of range" );
+            memcpy( &oBuf[indices[j] * pointBytes], &values[j * pointBytes],
+                    pointBytes );
+        }
+    }
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+Util::uint64_t
+ReadDataSize( Ogawa::IDataPtr iData,
+              size_t iThreadId,
+              bool iIsCompressed )
+{
+    if ( iIsCompressed )
+    {
+        if ( iData->getSize() < COMPRESSED_HEADER_SIZE )
+        {
+            return 0;
+        }
+
+        Util::uint64_t numBytes = 0;
+        iData->read( 8, &numBytes, 16, iThreadId );
+        return numBytes;
+    }
+
+    if ( iData->getSize() < 16 )
+    {
+        return 0;
+    }
+
+    return iData->getSize() - 16;
+}
+
 //-*****************************************************************************
 void
 ReadDimensions( Ogawa::IDataPtr iDims,
                 Ogawa::IDataPtr iData,
                 size_t iThreadId,
                 const AbcA::DataType &iDataType,
-                Util::Dimensions & oDim )
+                Util::Dimensions & oDim,
+                bool iIsCompressed )
 {
     // find it based on of the size of the data
     if ( iDims->getSize() == 0 )
@@ -58,8 +336,9 @@ ReadDimensions( Ogawa::IDataPtr iDims,
         }
         else
         {
-            oDim = Util::Dimensions( ( iData->getSize() - 16 ) /
-                                     iDataType.getNumBytes() );
+            oDim = Util::Dimensions(
+                ReadDataSize( iData, iThreadId, iIsCompressed ) /
+                iDataType.getNumBytes() );
         }
     }
     // we need to read our dimensions
@@ -1292,13 +1571,93 @@ ConvertData( Alembic::Util::PlainOldDataType fromPod,
     }
 }
 
+namespace {
+
+//-*****************************************************************************
+// the same as ReadData, but from the decompressed bytes of a sample
+void readDecompressedData( void * iIntoLocation,
+                           std::vector< char > & iBuf,
+                           Util::PlainOldDataType iCurPod,
+                           Util::PlainOldDataType iAsPod )
+{
+    std::size_t numBytes = iBuf.size();
+    if ( numBytes == 0 )
+    {
+        return;
+    }
+
+    if ( iCurPod == Alembic::Util::kStringPOD )
+    {
+        std::string * strPtr =
+            reinterpret_cast< std::string * > ( iIntoLocation );
+
+        std::size_t startStr = 0;
+        std::size_t strPos = 0;
+
+        for ( std::size_t i = 0; i < numBytes; ++i )
+        {
+            if ( iBuf[i] == 0 )
+            {
+                strPtr[strPos] = &iBuf[startStr];
+                startStr = i + 1;
+                strPos ++;
+            }
+        }
+    }
+    else if ( iCurPod == Alembic::Util::kWstringPOD )
+    {
+        std::wstring * wstrPtr =
+            reinterpret_cast< std::wstring * > ( iIntoLocation );
+
+        std::size_t numChars = numBytes / 4;
+        const Util::uint32_t * buf =
+            reinterpret_cast< const Util::uint32_t * >( &iBuf.front() );
+
+        std::size_t strPos = 0;
+
+        for ( std::size_t i = 0; i < numChars; ++i )
+        {
+            std::wstring & wstr = wstrPtr[strPos];
+            if ( buf[i] == 0 )
+            {
+                strPos ++;
+            }
+            else
+            {
+                wstr.push_back( buf[i] );
+            }
+        }
+    }
+    else if ( iAsPod == iCurPod )
+    {
+        memcpy( iIntoLocation, &iBuf.front(), numBytes );
+    }
+    else if ( PODNumBytes( iCurPod ) <= PODNumBytes( iAsPod ) )
+    {
+        memcpy( iIntoLocation, &iBuf.front(), numBytes );
+
+        char * buf = static_cast< char * >( iIntoLocation );
+        ConvertData( iCurPod, iAsPod, buf, iIntoLocation, numBytes );
+    }
+    else
+    {
+        ConvertData( iCurPod, iAsPod, &iBuf.front(), iIntoLocation,
+                     numBytes );
+    }
+}
+
+} // End anonymous namespace
+
 //-*****************************************************************************
 void
 ReadData( void * iIntoLocation,
           Ogawa::IDataPtr iData,
           size_t iThreadId,
           const AbcA::DataType &iDataType,
-          Util::PlainOldDataType iAsPod )
+          Util::PlainOldDataType iAsPod,
+          bool iIsCompressed,
+          Ogawa::IGroupPtr iGroup,
+          std::size_t iIndex )
 {
     Alembic::Util::PlainOldDataType curPod = iDataType.getPod();
     ABCA_ASSERT( ( iAsPod == curPod ) || (
@@ -1310,6 +1669,25 @@ ReadData( void * iIntoLocation,
 
     std::size_t dataSize = iData->getSize();
 
+    if ( iIsCompressed && dataSize > 0 )
+    {
+        std::size_t podSize = PODNumBytes( curPod );
+        if ( curPod == Alembic::Util::kStringPOD )
+        {
+            podSize = sizeof( Util::int8_t );
+        }
+        else if ( curPod == Alembic::Util::kWstringPOD )
+        {
+            podSize = sizeof( Util::int32_t );
+        }
+
+        std::vector< char > buf;
+        decompressData( iData, iThreadId, podSize, iDataType.getExtent(),
+                        buf, iGroup, iIndex );
+        readDecompressedData( iIntoLocation, buf, curPod, iAsPod );
+        return;
+    }
+
     if ( dataSize < 16 )
     {
         ABCA_ASSERT( dataSize == 0,
@@ -1410,22 +1788,62 @@ ReadData( void * iIntoLocation,
 
 }
 
+//-*****************************************************************************
+// Deletes an ArraySample which points directly into a memory mapped archive,
+// holding onto the IData keeps the mapping alive for as long as the sample is.
+struct MappedArraySampleDeleter
+{
+    MappedArraySampleDeleter( Ogawa::IDataPtr iData ) : data( iData ) {}
+
+    void operator()( AbcA::ArraySample * iSample )
+    {
+        delete iSample;
+    }
+
+    Ogawa::IDataPtr data;
+};
+
 //-*****************************************************************************
 void
 ReadArraySample( Ogawa::IDataPtr iDims,
                  Ogawa::IDataPtr iData,
                  size_t iThreadId,
                  const AbcA::DataType &iDataType,
-                 AbcA::ArraySamplePtr &oSample )
+                 AbcA::ArraySamplePtr &oSample,
+                 bool iIsCompressed,
+                 Ogawa::IGroupPtr iGroup,
+                 std::size_t iIndex )
 {
     // get our dimensions
     Util::Dimensions dims;
-    ReadDimensions( iDims, iData, iThreadId, iDataType, dims );
+    ReadDimensions( iDims, iData, iThreadId, iDataType, dims, iIsCompressed );
+
+    // If the archive is memory mapped, we don't need to convert and the
+    // data is suitably aligned then the sample can point right at the
+    // mapping, otherwise we allocate and copy below.
+    Util::PlainOldDataType pod = iDataType.getPod();
+    std::size_t numBytes = dims.numPoints() * iDataType.getNumBytes();
+    if ( !iIsCompressed && pod != Util::kStringPOD &&
+         pod != Util::kWstringPOD &&
+         numBytes > 0 && iData->getSize() == numBytes + 16 )
+    {
+        // skip the key
+        const void * mapped = iData->getMappedData( numBytes, 16 );
+        if ( mapped != NULL &&
+             reinterpret_cast< std::size_t >( mapped ) %
+             PODNumBytes( pod ) == 0 )
+        {
+            oSample.reset( new AbcA::ArraySample( mapped, iDataType, dims ),
+                           MappedArraySampleDeleter( iData ) );
+            return;
+        }
+    }
 
     oSample = AbcA::AllocateArraySample( iDataType, dims );
 
     ReadData( const_cast<void*>( oSample->getData() ), iData,
-        iThreadId, iDataType, iDataType.getPod() );
+        iThreadId, iDataType, iDataType.getPod(), iIsCompressed, iGroup,
+        iIndex );
 
 }
 
@@ -1526,6 +1944,64 @@ ReadObjectHeaders( Ogawa::IGroupPtr iGroup,
     }
 }
 
+//-*****************************************************************************
+void
+ReadObjectIndex( Ogawa::IDataPtr iData,
+                 size_t iThreadId,
+                 const std::vector< AbcA::MetaData > & iMetaDataVec,
+                 std::vector< ObjectHeaderPtr > & oHeaders,
+                 std::vector< Util::uint32_t > & oChildIndices )
+{
+    ABCA_ASSERT( iData, "ReadObjectIndex Invalid data" );
+
+    if ( iData->getSize() == 0 )
+    {
+        return;
+    }
+
+    std::vector< char > buf( iData->getSize() );
+    iData->read( buf.size(), &( buf.front() ), 0, iThreadId );
+    std::size_t pos = 0;
+    while ( pos < buf.size() )
+    {
+        Util::uint32_t childIndex = *( (Util::uint32_t *)( &buf[pos] ) );
+        pos += 4;
+
+        Util::uint32_t nameSize = *( (Util::uint32_t *)( &buf[pos] ) );
+        pos += 4;
+
+        std::string fullName( &buf[pos], nameSize );
+        pos += nameSize;
+
+        Util::uint8_t metaDataIndex = buf[pos++];
+
+        ObjectHeaderPtr objPtr( new AbcA::ObjectHeader() );
+        objPtr->setName( fullName.substr( fullName.rfind( '/' ) + 1 ) );
+        objPtr->setFullName( fullName );
+
+        if ( metaDataIndex == 0xff )
+        {
+            Util::uint32_t metaDataSize = *( (Util::uint32_t *)( &buf[pos] ) );
+            pos += 4;
+
+            std::string metaData( &buf[pos], metaDataSize );
+            pos += metaDataSize;
+
+            objPtr->getMetaData().deserialize( metaData );
+        }
+        else
+        {
+            ABCA_ASSERT( metaDataIndex < iMetaDataVec.size(),
+                "ReadObjectIndex Invalid meta data index: "
+                << ( Util::uint32_t ) metaDataIndex );
+            objPtr->getMetaData() = iMetaDataVec[metaDataIndex];
+        }
+
+        oHeaders.push_back( objPtr );
+        oChildIndices.push_back( childIndex );
+    }
+}
+
 //-*****************************************************************************
 Util::uint32_t GetUint32WithHint(const std::vector< char > & iBuf,
                            Util::uint32_t iSizeHint,
@@ -1587,6 +2063,9 @@ ReadPropertyHeaders( Ogawa::IGroupPtr iGroup,
     // 0000 1111 1111 0000 0000 0000 0000 0000
     static const Util::uint32_t metaDataIndexMask = 0xff00000;
 
+    // 0001 0000 0000 0000 0000 0000 0000 0000
+    static const Util::uint32_t compressedMask = 0x10000000;
+
     Ogawa::IDataPtr data = iGroup->getData( iIndex, iThreadId );
     ABCA_ASSERT( data, "ReadObjectHeaders Invalid data at index " << iIndex );
 
@@ -1653,6 +2132,8 @@ ReadPropertyHeaders( Ogawa::IGroupPtr iGroup,
 
             header->isHomogenous = ( info & homogenousMask ) != 0;
 
+            header->isCompressed = ( info & compressedMask ) != 0;
+
             header->nextSampleIndex = GetUint32WithHint( buf, sizeHint, pos );
 
             if ( ( info & needsFirstLastMask ) != 0 )
@@ -48,13 +48,27 @@ namespace ALEMBIC_VERSION_NS {
 // UTILITY THING
 //-*****************************************************************************
 
+//-*****************************************************************************
+// iIsCompressed is true for the samples of compressed array properties, see
+// PropertyHeaderAndFriends::isCompressed.  Their data might only hold what
+// changed since the samples before it, iGroup and iIndex are where iData is
+// so those samples can be found.
+
+//-*****************************************************************************
+// The number of bytes in the sample, not counting the key
+Util::uint64_t
+ReadDataSize( Ogawa::IDataPtr iData,
+              size_t iThreadId,
+              bool iIsCompressed = false );
+
 //-*****************************************************************************
 void
 ReadDimensions( Ogawa::IDataPtr iDims,
                 Ogawa::IDataPtr iData,
                 size_t iThreadId,
                 const AbcA::DataType &iDataType,
-                Util::Dimensions & oDim );
+                Util::Dimensions & oDim,
+                bool iIsCompressed = false );
 
 //-*****************************************************************************
 void
@@ -62,7 +76,10 @@ ReadData( void * iIntoLocation,
           Ogawa::IDataPtr iData,
           size_t iThreadId,
           const AbcA::DataType &iDataType,
-          Util::PlainOldDataType iAsPod );
+          Util::PlainOldDataType iAsPod,
+          bool iIsCompressed = false,
+          Ogawa::IGroupPtr iGroup = Ogawa::IGroupPtr(),
+          std::size_t iIndex = 0 );
 
 //-*****************************************************************************
 void
@@ -70,7 +87,10 @@ ReadArraySample( Ogawa::IDataPtr iDims,
                  Ogawa::IDataPtr iData,
                  size_t iThreadId,
                  const AbcA::DataType &iDataType,
-                 AbcA::ArraySamplePtr &oSample );
+                 AbcA::ArraySamplePtr &oSample,
+                 bool iIsCompressed = false,
+                 Ogawa::IGroupPtr iGroup = Ogawa::IGroupPtr(),
+                 std::size_t iIndex = 0 );
 
 //-*****************************************************************************
 void
@@ -96,6 +116,15 @@ ReadPropertyHeaders( Ogawa::IGroupPtr iGroup,
                      const std::vector< AbcA::MetaData > & iMetaDataVec,
                      PropertyHeaderPtrs & oHeaders );
 
+//-*****************************************************************************
+// see WriteObjectIndexEntry
+void
+ReadObjectIndex( Ogawa::IDataPtr iData,
+                 size_t iThreadId,
+                 const std::vector< AbcA::MetaData > & iMetaDataVec,
+                 std::vector< ObjectHeaderPtr > & oHeaders,
+                 std::vector< Util::uint32_t > & oChildIndices );
+
 //-*****************************************************************************
 void
 ReadIndexedMetaData( Ogawa::IDataPtr iData,
@@ -45,6 +45,18 @@ namespace ALEMBIC_VERSION_NS {
 
 //-*****************************************************************************
 WriteArchive::WriteArchive()
+    : m_indexObjects( false )
+    , m_writeInBackground( false )
+    , m_bufferSize( Ogawa::OStream::DEFAULT_BUFFER_SIZE )
+{
+}
+
+//-*****************************************************************************
+WriteArchive::WriteArchive( bool iIndexObjects, bool iWriteInBackground,
+                            std::size_t iBufferSize )
+    : m_indexObjects( iIndexObjects )
+    , m_writeInBackground( iWriteInBackground )
+    , m_bufferSize( iBufferSize )
 {
 }
 
@@ -53,7 +65,10 @@ AbcA::ArchiveWriterPtr
 WriteArchive::operator()( const std::string &iFileName,
                           const AbcA::MetaData &iMetaData ) const
 {
-    AbcA::ArchiveWriterPtr archivePtr( new AwImpl( iFileName, iMetaData ) );
+    AbcA::ArchiveWriterPtr archivePtr( new AwImpl( iFileName, iMetaData,
+                                                   m_indexObjects,
+                                                   m_writeInBackground,
+                                                   m_bufferSize ) );
     return archivePtr;
 }
 
@@ -62,7 +77,10 @@ AbcA::ArchiveWriterPtr
 WriteArchive::operator()( std::ostream * iStream,
                           const AbcA::MetaData &iMetaData ) const
 {
-    AbcA::ArchiveWriterPtr archivePtr( new AwImpl( iStream, iMetaData ) );
+    AbcA::ArchiveWriterPtr archivePtr( new AwImpl( iStream, iMetaData,
+                                                   m_indexObjects,
+                                                   m_writeInBackground,
+                                                   m_bufferSize ) );
     return archivePtr;
 }
 
@@ -70,17 +88,27 @@ WriteArchive::operator()( std::ostream * iStream,
 ReadArchive::ReadArchive()
 {
     m_numStreams = 1;
+    m_useMMap = false;
+    m_preloadHierarchy = false;
+    m_collectStats = false;
 }
 
 //-*****************************************************************************
-ReadArchive::ReadArchive( size_t iNumStreams )
+ReadArchive::ReadArchive( size_t iNumStreams, bool iUseMMap,
+                          bool iPreloadHierarchy, bool iCollectStats,
+                          AbcA::ReadTracerPtr iTracer )
 {
     m_numStreams = iNumStreams;
+    m_useMMap = iUseMMap;
+    m_preloadHierarchy = iPreloadHierarchy;
+    m_collectStats = iCollectStats;
+    m_tracer = iTracer;
 }
 
 //-*****************************************************************************
 ReadArchive::ReadArchive( const std::vector< std::istream * > & iStreams )
-    : m_numStreams( 1 ), m_streams( iStreams )
+    : m_numStreams( 1 ), m_useMMap( false ), m_preloadHierarchy( false )
+    , m_collectStats( false ), m_streams( iStreams )
 {
 }
 
@@ -93,7 +121,11 @@ ReadArchive::operator()( const std::string &iFileName ) const
     if ( m_streams.empty() )
     {
         archivePtr =
-            AbcA::ArchiveReaderPtr( new ArImpl( iFileName, m_numStreams ) );
+            AbcA::ArchiveReaderPtr( new ArImpl( iFileName, m_numStreams,
+                                                m_useMMap,
+                                                m_preloadHierarchy,
+                                                m_collectStats,
+                                                m_tracer ) );
     }
     else
     {
@@ -104,7 +136,6 @@ ReadArchive::operator()( const std::string &iFileName ) const
 }
 
 //-*****************************************************************************
-// The given cache is ignored.
 AbcA::ArchiveReaderPtr
 ReadArchive::operator()( const std::string &iFileName,
             AbcA::ReadArraySampleCachePtr iCache ) const
@@ -114,16 +145,42 @@ ReadArchive::operator()( const std::string &iFileName,
     if ( m_streams.empty() )
     {
         archivePtr =
-            AbcA::ArchiveReaderPtr( new ArImpl( iFileName, m_numStreams ) );
+            AbcA::ArchiveReaderPtr( new ArImpl( iFileName, m_numStreams,
+                                                m_useMMap,
+                                                m_preloadHierarchy,
+                                                m_collectStats,
+                                                m_tracer ) );
     }
     else
     {
         archivePtr =
             AbcA::ArchiveReaderPtr( new ArImpl( m_streams ) );
     }
+
+    archivePtr->setReadArraySampleCachePtr( iCache );
     return archivePtr;
 }
 
+//-*****************************************************************************
+ThreadStreamBinding::ThreadStreamBinding( AbcA::ArchiveReaderPtr iArchive )
+    : m_archive( iArchive ), m_binding( NULL )
+{
+    Alembic::Util::shared_ptr< ArImpl > archive =
+        Alembic::Util::dynamic_pointer_cast< ArImpl, AbcA::ArchiveReader >(
+            iArchive );
+
+    if ( archive )
+    {
+        m_binding = new StreamBinding( archive->getStreamManager() );
+    }
+}
+
+//-*****************************************************************************
+ThreadStreamBinding::~ThreadStreamBinding()
+{
+    delete m_binding;
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreOgawa
 } // End namespace Alembic
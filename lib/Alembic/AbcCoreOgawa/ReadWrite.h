@@ -38,6 +38,7 @@
 #define _Alembic_AbcCoreOgawa_ReadWrite_h_
 
 #include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/Ogawa/OStream.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -50,6 +51,18 @@ class WriteArchive
 public:
     WriteArchive();
 
+    // If iIndexObjects is true an index of the full name, and meta data, of
+    // every object is written at the end of the archive so readers can find
+    // an object without reading the ones above it.  Older readers ignore it.
+    // If iWriteInBackground is true the file is written by another thread
+    // while samples are being set.  iBufferSize is how many bytes are
+    // gathered up before being written, when writing in the background up
+    // to two buffers are held.  See Ogawa::OStream.
+    explicit WriteArchive( bool iIndexObjects,
+                           bool iWriteInBackground = false,
+                           std::size_t iBufferSize =
+                               Ogawa::OStream::DEFAULT_BUFFER_SIZE );
+
     ::Alembic::AbcCoreAbstract::ArchiveWriterPtr
     operator()( const std::string &iFileName,
                 const ::Alembic::AbcCoreAbstract::MetaData &iMetaData ) const;
@@ -57,6 +70,11 @@ public:
     ::Alembic::AbcCoreAbstract::ArchiveWriterPtr
     operator()( std::ostream * iStream,
                 const ::Alembic::AbcCoreAbstract::MetaData &iMetaData ) const;
+
+private:
+    bool m_indexObjects;
+    bool m_writeInBackground;
+    std::size_t m_bufferSize;
 };
 
 //-*****************************************************************************
@@ -68,7 +86,18 @@ public:
     ReadArchive();
 
     // Open the file iNumStreams times and manage them internally
-    ReadArchive( size_t iNumStreams );
+    // If iUseMMap is true the file is memory mapped instead and read without
+    // any locking, iNumStreams is only used if the mapping fails.
+    // If iPreloadHierarchy is true every object, and compound property,
+    // header in the archive is read on open using a thread per core (at most
+    // iNumStreams unless memory mapped) instead of as they are asked for.
+    // If iCollectStats is true the archive counts what it reads, see
+    // ArchiveReader::getReadStats, and iTracer (if given) is told about
+    // each read as it happens.  Neither is free, so only ask when needed.
+    ReadArchive( size_t iNumStreams, bool iUseMMap=false,
+                 bool iPreloadHierarchy=false, bool iCollectStats=false,
+                 ::Alembic::AbcCoreAbstract::ReadTracerPtr iTracer =
+                     ::Alembic::AbcCoreAbstract::ReadTracerPtr() );
 
     // Read from the provided streams, we do not own these, expect them
     // to remain open and all have the same data in them, and do not try to
@@ -79,7 +108,9 @@ public:
     ::Alembic::AbcCoreAbstract::ArchiveReaderPtr
     operator()( const std::string &iFileName ) const;
 
-    // The given cache is ignored.
+    // open the file, array samples are shared through iCache by the digest
+    // stored with each one.  If the archive is read from more than one thread
+    // the cache needs to be thread safe.
     ::Alembic::AbcCoreAbstract::ArchiveReaderPtr
     operator()( const std::string &iFileName,
                 ::Alembic::AbcCoreAbstract::ReadArraySampleCachePtr iCache
@@ -87,9 +118,37 @@ public:
 
 private:
     size_t m_numStreams;
+    bool m_useMMap;
+    bool m_preloadHierarchy;
+    bool m_collectStats;
+    ::Alembic::AbcCoreAbstract::ReadTracerPtr m_tracer;
     std::vector< std::istream * > m_streams;
 };
 
+class StreamBinding;
+
+//-*****************************************************************************
+//! While this exists, every read the current thread makes from iArchive
+//! uses the same stream instead of picking a free one for each read.
+//! Handy for worker threads which read a batch of small samples.
+//! It must be destroyed on the thread that made it, and it does nothing if
+//! iArchive wasn't read via AbcCoreOgawa.  ArchiveReader::bindReadStream
+//! hands these out too.
+class ThreadStreamBinding
+    : public ::Alembic::AbcCoreAbstract::ReadStreamBinding
+{
+public:
+    explicit ThreadStreamBinding(
+        ::Alembic::AbcCoreAbstract::ArchiveReaderPtr iArchive );
+
+    ~ThreadStreamBinding();
+
+private:
+    // keeps the archive, and the streams, alive while bound
+    ::Alembic::AbcCoreAbstract::ArchiveReaderPtr m_archive;
+    StreamBinding * m_binding;
+};
+
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
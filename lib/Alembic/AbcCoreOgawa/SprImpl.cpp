@@ -50,12 +50,22 @@ SprImpl::SprImpl( AbcA::CompoundPropertyReaderPtr iParent,
   : m_parent( iParent )
   , m_group( iGroup )
   , m_header( iHeader )
+  , m_archive( NULL )
 {
     // Validate all inputs.
     ABCA_ASSERT( m_parent, "Invalid parent" );
     ABCA_ASSERT( m_group, "Invalid scalar property group" );
     ABCA_ASSERT( m_header, "Invalid header" );
 
+    m_archive = Alembic::Util::dynamic_pointer_cast< ArImpl,
+        AbcA::ArchiveReader > ( m_parent->getObject()->getArchive() ).get();
+    ABCA_ASSERT( m_archive, "Invalid archive" );
+
+    if ( m_archive->getReadStatsCollector() )
+    {
+        m_archive->getReadStatsCollector()->property( m_header->header );
+    }
+
     if ( m_header->header.getPropertyType() != AbcA::kScalarProperty )
     {
         ABCA_THROW( "Attempted to create a ScalarPropertyReader from a "
@@ -104,10 +114,8 @@ void SprImpl::getSample( index_t iSampleIndex, void * iIntoLocation )
 {
     size_t index = m_header->verifyIndex( iSampleIndex );
 
-    StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
-        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
-
-    std::size_t id = streamId->getID();
+    StreamID streamId( m_archive->getStreamManager() );
+    std::size_t id = streamId.getID();
     Ogawa::IDataPtr data = m_group->getData( index, id );
     ReadData( iIntoLocation, data, id,
               m_header->header.getDataType(),
@@ -43,6 +43,8 @@ namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+class ArImpl;
+
 //-*****************************************************************************
 // The Scalar Property Reader fills up bytes corresponding to memory for
 // a single scalar sample at a particular index.
@@ -81,6 +83,9 @@ private:
     // Stores the PropertyHeader and other info
     PropertyHeaderPtr m_header;
 
+    // The archive we belong to, kept alive by m_parent.  Held onto so each
+    // read doesn't need to look it up and cast it.
+    ArImpl * m_archive;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
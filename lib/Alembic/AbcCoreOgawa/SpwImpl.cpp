@@ -105,6 +105,8 @@ SpwImpl::~SpwImpl()
 //-*****************************************************************************
 void SpwImpl::setFromPreviousSample()
 {
+    Alembic::Util::scoped_lock l(
+        GetWriteMutex( this->getObject()->getArchive() ) );
 
     // Make sure we aren't writing more samples than we have times for
     // This applies to acyclic sampling only
@@ -127,6 +129,9 @@ void SpwImpl::setFromPreviousSample()
 //-*****************************************************************************
 void SpwImpl::setSample( const void *iSamp )
 {
+    Alembic::Util::scoped_lock l(
+        GetWriteMutex( this->getObject()->getArchive() ) );
+
     // Make sure we aren't writing more samples than we have times for
     // This applies to acyclic sampling only
     ABCA_ASSERT(
@@ -40,133 +40,141 @@ namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+// the innermost StreamBinding made on this thread
+#if defined( _MSC_VER )
+#define ALEMBIC_OGAWA_THREAD_BINDING
+static __declspec( thread ) StreamBinding * g_threadBinding = NULL;
+#elif defined( __GNUC__ ) && __GNUC__ > 3
+#define ALEMBIC_OGAWA_THREAD_BINDING
+static __thread StreamBinding * g_threadBinding = NULL;
+#endif
+
 StreamManager::StreamManager( std::size_t iNumStreams )
 {
 
-    m_streams = 0;
     m_curStream = 0;
     m_numStreams = iNumStreams;
+    m_nextShared = 0;
 
     // only do this if we have more than 1 stream
     // otherwise we can just return default
     if ( iNumStreams > 1 )
     {
         m_streamIDs.resize( m_numStreams );
+        m_streams.resize( ( m_numStreams + 63 ) / 64, 0 );
         for ( std::size_t i = 0; i < m_numStreams; ++i )
         {
             m_streamIDs[i] = i;
-            if ( m_numStreams < sizeof(m_streams) * 8 )
-            {
-                m_streams |= 1 << i;
-            }
+            m_streams[i / 64] |= ( Alembic::Util::uint64_t ) 1 << ( i % 64 );
         }
     }
-
-    m_default = StreamIDPtr( new StreamID( NULL, 0 ) );
 }
 
 StreamManager::~StreamManager()
 {
 }
 
-#if !defined(__APPLE__) && defined(__GNUC__) && __GNUC__ > 3
+#if defined(__GNUC__) && __GNUC__ > 3
 
-StreamIDPtr StreamManager::get()
+// the value read here is only a guess, the compare and swap checks it
+static inline Alembic::Util::uint64_t
+loadWord( Alembic::Util::uint64_t * iWord )
 {
+#ifdef __ATOMIC_RELAXED
+    return __atomic_load_n( iWord, __ATOMIC_RELAXED );
+#else
+    return *iWord;
+#endif
+}
 
-    if ( m_numStreams < 2 )
-    {
-        return m_default;
-    }
+std::size_t StreamManager::get( bool & oManaged )
+{
+    oManaged = false;
 
-    // we've got too many streams so use the locking version
-    if ( m_numStreams > sizeof(m_streams) * 8 )
+    // CAS (compare and swap) non locking version, look for a free bit in
+    // each word in turn
+    for ( std::size_t i = 0; i < m_streams.size(); ++i )
     {
-        Alembic::Util::scoped_lock l( m_lock );
+        Alembic::Util::uint64_t oldVal = 0;
+        Alembic::Util::uint64_t newVal = 0;
+        std::size_t bit = 0;
 
-        // we've used up more than we have, just return the default
-        if ( m_curStream >= m_numStreams )
+        do
         {
-            return m_default;
-        }
-
-        return StreamIDPtr( new StreamID( this,
-            m_streamIDs[ m_curStream ++ ] ) );
-    }
+            oldVal = loadWord( &m_streams[i] );
 
-    // CAS (compare and swap) non locking version
-    Alembic::Util::int64_t val = 0;
-    Alembic::Util::int64_t oldVal = 0;
-    Alembic::Util::int64_t newVal = 0;
+            if ( oldVal == 0 )
+            {
+                break;
+            }
 
-    do
-    {
-        oldVal = m_streams;
-        val = ffsll( oldVal );
+            bit = __builtin_ctzll( oldVal );
+            newVal = oldVal & ~( ( Alembic::Util::uint64_t ) 1 << bit );
+        }
+        while ( !__sync_bool_compare_and_swap( &m_streams[i], oldVal,
+                                               newVal ) );
 
-        if ( val == 0 )
+        if ( oldVal != 0 )
         {
-            return m_default;
+            oManaged = true;
+            return i * 64 + bit;
         }
+    }
 
-        newVal = oldVal & ~( 1 << (val - 1) );
+    // we only have the one
+    if ( m_numStreams < 2 )
+    {
+        return 0;
     }
-    while ( !__sync_bool_compare_and_swap( &m_streams, oldVal, newVal ) );
 
-    return StreamIDPtr( new StreamID( this, ( std::size_t ) val - 1 ) );
+    // they are all in use, so share them in turn
+    return __sync_fetch_and_add( &m_nextShared, 1 ) % m_numStreams;
 }
 
 void StreamManager::put( std::size_t iStreamID )
 {
-
-    // we've got too many streams so use the locking version
-    if ( m_numStreams > sizeof(m_streams) * 8 )
-    {
-        // shouldn't ever hit this case, it's why we have m_default
-        assert( iStreamID < m_numStreams && m_curStream > 0 );
-
-        Alembic::Util::scoped_lock l( m_lock );
-        m_streamIDs[ --m_curStream ] = iStreamID;
-        return;
-    }
-
     // CAS (compare and swap) non locking version
-    Alembic::Util::int64_t oldVal = 0;
-    Alembic::Util::int64_t newVal = 0;
+    Alembic::Util::uint64_t * word = &m_streams[ iStreamID / 64 ];
+    Alembic::Util::uint64_t bit =
+        ( Alembic::Util::uint64_t ) 1 << ( iStreamID % 64 );
+    Alembic::Util::uint64_t oldVal = 0;
+    Alembic::Util::uint64_t newVal = 0;
 
     do
     {
-        oldVal = m_streams;
-        newVal = oldVal | ( 1 << iStreamID );
-
+        oldVal = loadWord( word );
+        newVal = oldVal | bit;
     }
-    while ( !__sync_bool_compare_and_swap( &m_streams, oldVal, newVal ) );
+    while ( !__sync_bool_compare_and_swap( word, oldVal, newVal ) );
 }
 
 #else
 
-StreamIDPtr StreamManager::get()
+std::size_t StreamManager::get( bool & oManaged )
 {
+    oManaged = false;
+
     // no need to lock
     if ( m_streamIDs.empty() )
     {
-        return m_default;
+        return 0;
     }
 
     Alembic::Util::scoped_lock l( m_lock );
 
-    // we've used up more than we have, just return the default
+    // we've used up more than we have, so share them in turn
     if ( m_curStream >= m_numStreams )
     {
-        return m_default;
+        return m_nextShared++ % m_numStreams;
     }
 
-    return StreamIDPtr( new StreamID( this, m_streamIDs[ m_curStream ++ ] ) );
+    oManaged = true;
+    return m_streamIDs[ m_curStream ++ ];
 }
 
 void StreamManager::put( std::size_t iStreamID )
 {
-    // shouldn't ever hit this case, it's why we have m_default
+    // shouldn't ever hit this case, it's why we have the default
     assert( iStreamID < m_numStreams && m_curStream > 0 );
 
     Alembic::Util::scoped_lock l( m_lock );
@@ -175,9 +183,28 @@ void StreamManager::put( std::size_t iStreamID )
 
 #endif
 
-StreamID::StreamID( StreamManager * iManager, std::size_t iStreamID ) :
-    m_manager( iManager ), m_streamID( iStreamID )
+StreamID::StreamID( StreamManager & iManager ) :
+    m_manager( NULL ), m_streamID( 0 )
 {
+#ifdef ALEMBIC_OGAWA_THREAD_BINDING
+    // use the bound stream if we have one
+    for ( StreamBinding * binding = g_threadBinding; binding != NULL;
+          binding = binding->m_previous )
+    {
+        if ( binding->m_manager == &iManager )
+        {
+            m_streamID = binding->m_streamID;
+            return;
+        }
+    }
+#endif
+
+    bool managed = false;
+    m_streamID = iManager.get( managed );
+    if ( managed )
+    {
+        m_manager = &iManager;
+    }
 }
 
 StreamID::~StreamID()
@@ -189,6 +216,52 @@ StreamID::~StreamID()
     }
 }
 
+StreamBinding::StreamBinding( StreamManager & iManager ) :
+    m_manager( &iManager ), m_streamID( 0 ), m_managed( false ),
+    m_previous( NULL )
+{
+#ifdef ALEMBIC_OGAWA_THREAD_BINDING
+    m_previous = g_threadBinding;
+    g_threadBinding = this;
+
+    // nested in another binding for the same manager, use its stream
+    for ( StreamBinding * binding = m_previous; binding != NULL;
+          binding = binding->m_previous )
+    {
+        if ( binding->m_manager == &iManager )
+        {
+            m_streamID = binding->m_streamID;
+            return;
+        }
+    }
+
+    m_streamID = iManager.get( m_managed );
+#endif
+}
+
+StreamBinding::~StreamBinding()
+{
+#ifdef ALEMBIC_OGAWA_THREAD_BINDING
+    // bindings are expected to be destroyed in the reverse order they were
+    // made, but don't leave a dangling pointer if they aren't
+    StreamBinding ** binding = &g_threadBinding;
+    while ( *binding != NULL && *binding != this )
+    {
+        binding = &( ( *binding )->m_previous );
+    }
+
+    if ( *binding == this )
+    {
+        *binding = m_previous;
+    }
+
+    if ( m_managed )
+    {
+        m_manager->put( m_streamID );
+    }
+#endif
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace Ogawa
 } // End namespace Alembic
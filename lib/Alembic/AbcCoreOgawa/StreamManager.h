@@ -44,46 +44,74 @@ namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
-class StreamID;
-typedef Alembic::Util::shared_ptr< StreamID > StreamIDPtr;
-
 //-*****************************************************************************
+// Hands out which of the archive's streams a read should use.  Free streams
+// are tracked in a bitmap which is updated with compare and swap so any
+// number of streams can be handed out without locking.  If every stream is
+// in use the streams are shared in turn, so the extra readers are spread
+// across all of them instead of piling onto one, the reads are still safe
+// since Ogawa::IStreams locks each stream.
 class StreamManager : Alembic::Util::noncopyable
 {
 public:
     StreamManager( std::size_t iNumStreams );
     ~StreamManager();
-    StreamIDPtr get();
+
 private:
     friend class StreamID;
+    friend class StreamBinding;
+
+    // returns the id and sets oManaged to whether it needs to be given back
+    std::size_t get( bool & oManaged );
     void put( std::size_t iStreamID );
 
     std::size_t m_numStreams;
 
+    // which stream to share next when they are all in use
+    std::size_t m_nextShared;
+
     // for the locked implementation
     std::vector< std::size_t > m_streamIDs;
     std::size_t m_curStream;
     Alembic::Util::mutex m_lock;
 
-    // for the CAS impl
-    Alembic::Util::int64_t m_streams;
-
-    StreamIDPtr m_default;
+    // for the CAS impl, a set bit is a free stream, 64 streams per word
+    std::vector< Alembic::Util::uint64_t > m_streams;
 };
 
 //-*****************************************************************************
+// Picks a stream for the lifetime of this object, it is meant to live on the
+// stack around the reads which need it.  If the thread has a StreamBinding
+// for this manager, the bound stream is used.
 class StreamID : Alembic::Util::noncopyable
 {
 public:
+    StreamID( StreamManager & iManager );
     ~StreamID();
-    std::size_t getID() { return m_streamID; }
+    std::size_t getID() const { return m_streamID; }
 private:
-    friend class StreamManager;
-    StreamID( StreamManager * iManager, std::size_t iStreamID );
     StreamManager * m_manager;
     std::size_t m_streamID;
 };
 
+//-*****************************************************************************
+// While this exists every StreamID made for iManager on the same thread
+// reuses one stream, so a batch of reads doesn't keep picking a stream.
+// It has to be destroyed on the thread that created it, bindings can be
+// nested and a nested one reuses the stream of the one around it.  On
+// platforms without thread local storage this does nothing.
+class StreamBinding : Alembic::Util::noncopyable
+{
+public:
+    StreamBinding( StreamManager & iManager );
+    ~StreamBinding();
+private:
+    friend class StreamID;
+    StreamManager * m_manager;
+    std::size_t m_streamID;
+    bool m_managed;
+    StreamBinding * m_previous;
+};
 
 } // End namespace ALEMBIC_VERSION_NS
 
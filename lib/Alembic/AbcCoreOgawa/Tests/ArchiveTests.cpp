@@ -36,6 +36,7 @@
 
 #include <Alembic/AbcCoreAbstract/All.h>
 #include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/AbcCoreOgawa/StreamManager.h>
 #include <Alembic/Util/All.h>
 
 #include <Alembic/AbcCoreAbstract/Tests/Assert.h>
@@ -267,11 +268,14 @@ void testReadWriteMaxNumSamplesArchive()
     }
 }
 
-void writeArchive( const std::string & iName, std::ostream * iStream )
+void writeArchive( const std::string & iName, std::ostream * iStream,
+                   bool iWriteInBackground = false,
+                   std::size_t iBufferSize =
+                       Alembic::Ogawa::OStream::DEFAULT_BUFFER_SIZE )
 {
     ABCA::MetaData m;
     ABCA::ObjectHeader header("a", m);
-    AO::WriteArchive w;
+    AO::WriteArchive w( false, iWriteInBackground, iBufferSize );
     ABCA::ArchiveWriterPtr a;
     if (iStream)
     {
@@ -383,6 +387,161 @@ void readVeryEmptyArchive( const std::string & iName )
     TESTING_ASSERT(a->getTop()->getNumChildren() == 0);
 }
 
+//-*****************************************************************************
+void testObjectIndex()
+{
+    std::string archiveName = "objectIndexTest.abc";
+    {
+        AO::WriteArchive w( true );
+        ABCA::ArchiveWriterPtr a = w( archiveName, ABCA::MetaData() );
+        ABCA::ObjectWriterPtr top = a->getTop();
+
+        ABCA::MetaData md;
+        md.set( "schema", "AbcGeom_PolyMesh_v1" );
+
+        // a long meta data string can't go into the meta data map
+        ABCA::MetaData longMd;
+        longMd.set( "schema", std::string( 300, 'x' ) );
+
+        ABCA::ObjectWriterPtr b = top->createChild(
+            ABCA::ObjectHeader( "b", ABCA::MetaData() ) );
+        top->createChild( ABCA::ObjectHeader( "a", md ) );
+        ABCA::ObjectWriterPtr c = b->createChild(
+            ABCA::ObjectHeader( "c", md ) );
+        c->createChild( ABCA::ObjectHeader( "d", longMd ) );
+    }
+
+    {
+        AO::ReadArchive r;
+        ABCA::ArchiveReaderPtr a = r( archiveName );
+        TESTING_ASSERT( a->getNumIndexedObjects() == 4 );
+        TESTING_ASSERT( a->getIndexedObjectHeader( 0 ).getFullName() == "/b" );
+        TESTING_ASSERT( a->getIndexedObjectHeader( 1 ).getFullName() == "/a" );
+        TESTING_ASSERT( a->getIndexedObjectHeader( 1 ).getMetaData().get(
+            "schema" ) == "AbcGeom_PolyMesh_v1" );
+
+        const ABCA::ObjectHeader * header =
+            a->getIndexedObjectHeader( "/b/c/d" );
+        TESTING_ASSERT( header != NULL );
+        TESTING_ASSERT( header->getName() == "d" );
+        TESTING_ASSERT( header->getMetaData().get( "schema" ) ==
+                        std::string( 300, 'x' ) );
+
+        header = a->getIndexedObjectHeader( "/b/c" );
+        TESTING_ASSERT( header != NULL );
+        TESTING_ASSERT( header->getMetaData().get( "schema" ) ==
+                        "AbcGeom_PolyMesh_v1" );
+
+        TESTING_ASSERT( a->getIndexedObjectHeader( "/b/d" ) == NULL );
+
+        // the hierarchy reads the same as ever
+        ABCA::ObjectReaderPtr obj = a->getTop()->getChild( "b" )->getChild(
+            "c" )->getChild( "d" );
+        TESTING_ASSERT( obj->getFullName() == "/b/c/d" );
+    }
+
+    {
+        // no index
+        AO::ReadArchive r;
+        ABCA::ArchiveReaderPtr a = r( "test.abc" );
+        TESTING_ASSERT( a->getNumIndexedObjects() == 0 );
+        TESTING_ASSERT( a->getIndexedObjectHeader( "/b/c" ) == NULL );
+    }
+}
+
+// counts what it is told about
+class CountingTracer : public ABCA::ReadTracer
+{
+public:
+    CountingTracer() : numReads( 0 ), numProperties( 0 ), numLookups( 0 ) {}
+
+    virtual void read( Alembic::Util::uint64_t iPos,
+                       Alembic::Util::uint64_t iSize,
+                       std::size_t iStreamId, double iLockWait )
+    {
+        ++numReads;
+    }
+
+    virtual void property( const ABCA::PropertyHeader &iHeader )
+    {
+        names.push_back( iHeader.getName() );
+        ++numProperties;
+    }
+
+    virtual void cacheLookup( const ABCA::ArraySampleKey &iKey, bool iFound )
+    {
+        ++numLookups;
+    }
+
+    std::size_t numReads;
+    std::size_t numProperties;
+    std::size_t numLookups;
+    std::vector< std::string > names;
+};
+
+void testReadStats( const std::string & iName )
+{
+    {
+        // nothing is counted unless it is asked for
+        AO::ReadArchive r;
+        ABCA::ArchiveReaderPtr a = r( iName );
+        a->getTop()->getChild( 1 )->getChild( 2 );
+        TESTING_ASSERT( a->getReadStats().numReads == 0 );
+        TESTING_ASSERT( a->getReadStats().numObjects == 0 );
+    }
+
+    Alembic::Util::shared_ptr< CountingTracer > tracer( new CountingTracer );
+    ABCA::ReadArraySampleCachePtr cache(
+        new ABCA::LRUReadArraySampleCache( 1024 * 1024 ) );
+
+    AO::ReadArchive r( 2, false, false, true, tracer );
+    ABCA::ArchiveReaderPtr a = r( iName, cache );
+
+    // opening reads the top group and some of its data
+    ABCA::ReadStats stats = a->getReadStats();
+    TESTING_ASSERT( stats.numReads > 0 );
+    TESTING_ASSERT( stats.numReads == tracer->numReads );
+    TESTING_ASSERT( stats.numBytesRead > 0 );
+    TESTING_ASSERT( stats.numGroups > 0 );
+    TESTING_ASSERT( stats.numData > 0 );
+    TESTING_ASSERT( stats.numSeeks > 0 );
+
+    ABCA::ObjectReaderPtr obj = a->getTop()->getChild( 1 )->getChild( 2 );
+    stats = a->getReadStats();
+    TESTING_ASSERT( stats.numObjects == 3 );
+
+    a->resetReadStats();
+    stats = a->getReadStats();
+    TESTING_ASSERT( stats.numReads == 0 && stats.numBytesRead == 0 );
+    TESTING_ASSERT( stats.numObjects == 0 && stats.numGroups == 0 );
+
+    ABCA::ArrayPropertyReaderPtr apr =
+        obj->getProperties()->getArrayProperty( "c" );
+    TESTING_ASSERT( a->getReadStats().numProperties == 1 );
+    TESTING_ASSERT( tracer->names.back() == "c" );
+
+    ABCA::ArraySamplePtr samp;
+    apr->getSample( 1, samp );
+    apr->getSample( 1, samp );
+    stats = a->getReadStats();
+    TESTING_ASSERT( stats.numCacheMisses == 1 );
+    TESTING_ASSERT( stats.numCacheHits == 1 );
+    TESTING_ASSERT( tracer->numLookups == 2 );
+    TESTING_ASSERT( stats.numReads > 0 );
+    TESTING_ASSERT( stats.lockWaitTime >= 0.0 );
+
+    {
+        // memory mapped reads are counted too, but never seek
+        AO::ReadArchive mr( 1, true, false, true );
+        ABCA::ArchiveReaderPtr ma = mr( iName );
+        ma->getTop()->getChild( 1 )->getChild( 2 );
+        stats = ma->getReadStats();
+        TESTING_ASSERT( stats.numReads > 0 );
+        TESTING_ASSERT( stats.numSeeks == 0 );
+        TESTING_ASSERT( stats.numObjects == 3 );
+    }
+}
+
 int main ( int argc, char *argv[] )
 {
     testReadWriteEmptyArchive();
@@ -396,10 +555,95 @@ int main ( int argc, char *argv[] )
     strStream.seekg(0, strStream.beg);
     readArchive("", &strStream);
 
+    writeArchive("backgroundTest.abc", NULL, true);
+    readArchive("backgroundTest.abc", NULL);
+
+    // most writes are bigger than the buffer, so are handed over on their own
+    writeArchive("backgroundSmallTest.abc", NULL, true, 16);
+    readArchive("backgroundSmallTest.abc", NULL);
+
+    {
+        // same archive, but read from a memory mapping
+        Alembic::AbcCoreOgawa::ReadArchive r(4, true);
+        ABCA::ArchiveReaderPtr a = r( "test.abc" );
+        TESTING_ASSERT( a->getTop()->getNumChildren() == 2 );
+        ABCA::ObjectReaderPtr obj = a->getTop()->getChild(1)->getChild(2);
+        TESTING_ASSERT( obj->getFullName() == "/b/c" );
+        ABCA::ArrayPropertyReaderPtr apr =
+            obj->getProperties()->getArrayProperty("c");
+        TESTING_ASSERT( apr->getNumSamples() == 2 );
+        ABCA::ArraySamplePtr samp;
+        apr->getSample( 1, samp );
+        TESTING_ASSERT( samp->getDimensions().numPoints() == 2 );
+        TESTING_ASSERT(
+            ( ( const Alembic::Util::int32_t * ) samp->getData() )[1] == 0 );
+
+        // the sample may point into the mapping, make sure it stays valid
+        // after everything else has gone away
+        apr.reset();
+        obj.reset();
+        a.reset();
+        TESTING_ASSERT( samp->getDimensions().numPoints() == 2 );
+        TESTING_ASSERT(
+            ( ( const Alembic::Util::int32_t * ) samp->getData() )[1] == 0 );
+    }
+
+    {
+        // more streams than fit in a single word, and a thread binding
+        Alembic::AbcCoreOgawa::ReadArchive r(100);
+        ABCA::ArchiveReaderPtr a = r( "test.abc" );
+        ABCA::ArrayPropertyReaderPtr apr = a->getTop()->getChild(1)->
+            getChild(2)->getProperties()->getArrayProperty("c");
+
+        Alembic::AbcCoreOgawa::ThreadStreamBinding binding( a );
+        {
+            Alembic::AbcCoreOgawa::ThreadStreamBinding nested( a );
+            ABCA::ArraySamplePtr samp;
+            apr->getSample( 1, samp );
+            TESTING_ASSERT( samp->getDimensions().numPoints() == 2 );
+        }
+
+        ABCA::ArraySamplePtr samp;
+        apr->getSample( 0, samp );
+        TESTING_ASSERT( samp->getDimensions().numPoints() == 1 );
+    }
+
+    {
+        // bound through the abstract archive
+        Alembic::AbcCoreOgawa::ReadArchive r(2);
+        ABCA::ArchiveReaderPtr a = r( "test.abc" );
+        ABCA::ArrayPropertyReaderPtr apr = a->getTop()->getChild(1)->
+            getChild(2)->getProperties()->getArrayProperty("c");
+
+        ABCA::ReadStreamBindingPtr binding = a->bindReadStream();
+        TESTING_ASSERT( binding );
+
+        ABCA::ArraySamplePtr samp;
+        apr->getSample( 1, samp );
+        TESTING_ASSERT( samp->getDimensions().numPoints() == 2 );
+    }
+
+    {
+        // once every stream is in use the extra readers are spread across
+        // all of them
+        Alembic::AbcCoreOgawa::StreamManager manager( 2 );
+        Alembic::AbcCoreOgawa::StreamID first( manager );
+        Alembic::AbcCoreOgawa::StreamID second( manager );
+        TESTING_ASSERT( first.getID() != second.getID() );
+
+        Alembic::AbcCoreOgawa::StreamID shared1( manager );
+        Alembic::AbcCoreOgawa::StreamID shared2( manager );
+        TESTING_ASSERT( shared1.getID() != shared2.getID() );
+    }
+
     writeVeryEmptyArchive("testEmpty.abc");
     readVeryEmptyArchive("testEmpty.abc");
 
     testReadWriteMaxNumSamplesArchive();
 
+    testObjectIndex();
+
+    testReadStats( "test.abc" );
+
     return 0;
 }
@@ -37,10 +37,13 @@
 #include <Alembic/AbcCoreAbstract/All.h>
 #include <Alembic/AbcCoreOgawa/All.h>
 #include <Alembic/Util/All.h>
+#include <Alembic/Ogawa/All.h>
 
 #include <Alembic/AbcCoreAbstract/Tests/Assert.h>
 
+#include <fstream>
 #include <iostream>
+#include <sstream>
 #include <vector>
 
 
@@ -1867,6 +1870,502 @@ void testArraySamples()
     }
 }
 
+//-*****************************************************************************
+void testGetSamples()
+{
+    std::string archiveName = "getSamplesTest.abc";
+
+    ABCA::DataType dtype(Alembic::Util::kInt32POD);
+
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+        ABCA::ObjectWriterPtr archive = a->getTop();
+
+        ABCA::ArrayPropertyWriterPtr prop =
+            archive->getProperties()->createArrayProperty("ints",
+                ABCA::MetaData(), dtype, 0);
+
+        // sample i has i+1 values of i, sample 2 is repeated as 3
+        for (Alembic::Util::int32_t i = 0; i < 5; ++i)
+        {
+            Alembic::Util::int32_t val = ( i == 3 ) ? 2 : i;
+            std::vector< Alembic::Util::int32_t > vals( val + 1, val );
+            prop->setSample( ABCA::ArraySample( &vals.front(), dtype,
+                Alembic::Util::Dimensions( vals.size() ) ) );
+        }
+    }
+
+    for (int useMMap = 0; useMMap < 2; ++useMMap)
+    {
+        AO::ReadArchive r( 1, useMMap != 0 );
+        ABCA::ArchiveReaderPtr a = r( archiveName );
+        ABCA::ArrayPropertyReaderPtr ap =
+            a->getTop()->getProperties()->getArrayProperty("ints");
+
+        std::vector< ABCA::index_t > indices;
+        indices.push_back( 4 );
+        indices.push_back( 2 );
+        indices.push_back( 3 );
+        indices.push_back( 0 );
+
+        std::vector< ABCA::ArraySamplePtr > samps;
+        ap->getSamples( indices, samps );
+        TESTING_ASSERT( samps.size() == 4 );
+        TESTING_ASSERT( samps[1] == samps[2] );
+        for ( std::size_t i = 0; i < samps.size(); ++i )
+        {
+            Alembic::Util::int32_t val = ( indices[i] == 3 ) ? 2 : indices[i];
+            TESTING_ASSERT( samps[i]->size() == ( std::size_t ) val + 1 );
+            const Alembic::Util::int32_t * data =
+                ( const Alembic::Util::int32_t * ) samps[i]->getData();
+            for ( std::size_t j = 0; j < samps[i]->size(); ++j )
+            {
+                TESTING_ASSERT( data[j] == val );
+            }
+        }
+
+        // laid out one after the other, 5 + 3 + 3 + 1
+        std::vector< Alembic::Util::int32_t > ints( 12, -1 );
+        ap->getSamplesAs( indices, &ints.front(), kInt32POD );
+
+        std::vector< Alembic::Util::int64_t > longs( 12, -1 );
+        ap->getSamplesAs( indices, &longs.front(), kInt64POD );
+
+        Alembic::Util::int32_t expected[12] = {4, 4, 4, 4, 4, 2, 2, 2,
+                                               2, 2, 2, 0};
+        for ( std::size_t i = 0; i < 12; ++i )
+        {
+            TESTING_ASSERT( ints[i] == expected[i] );
+            TESTING_ASSERT( longs[i] == expected[i] );
+        }
+
+        indices.push_back( 5 );
+        TESTING_ASSERT_THROW( ap->getSamples( indices, samps ),
+            Alembic::Util::Exception );
+    }
+}
+
+void writeCompressedArchive( const std::string & iName,
+                             Alembic::Util::int8_t iCompressionHint )
+{
+    AO::WriteArchive w;
+    ABCA::ArchiveWriterPtr a = w( iName, ABCA::MetaData() );
+    ABCA::CompoundPropertyWriterPtr top = a->getTop()->getProperties();
+
+    ABCA::DataType ftype( Alembic::Util::kFloat32POD, 3 );
+    ABCA::DataType itype( Alembic::Util::kInt32POD );
+    ABCA::DataType stype( Alembic::Util::kStringPOD );
+    ABCA::DataType wtype( Alembic::Util::kWstringPOD );
+
+    // created before the hint is set, so it isn't compressed
+    ABCA::ArrayPropertyWriterPtr plain =
+        top->createArrayProperty( "plain", ABCA::MetaData(), ftype, 0 );
+
+    a->setCompressionHint( iCompressionHint );
+
+    ABCA::ArrayPropertyWriterPtr floats =
+        top->createArrayProperty( "floats", ABCA::MetaData(), ftype, 0 );
+    ABCA::ArrayPropertyWriterPtr ints =
+        top->createArrayProperty( "ints", ABCA::MetaData(), itype, 0 );
+    ABCA::ArrayPropertyWriterPtr strs =
+        top->createArrayProperty( "strs", ABCA::MetaData(), stype, 0 );
+    ABCA::ArrayPropertyWriterPtr wstrs =
+        top->createArrayProperty( "wstrs", ABCA::MetaData(), wtype, 0 );
+
+    std::vector< Alembic::Util::float32_t > fvals( 3000 );
+    for ( std::size_t i = 0; i < fvals.size(); ++i )
+    {
+        fvals[i] = 0.5f * ( Alembic::Util::float32_t ) ( i / 3 );
+    }
+
+    ABCA::ArraySample fsamp( &fvals.front(), ftype,
+                             Alembic::Util::Dimensions( 1000 ) );
+    floats->setSample( fsamp );
+
+    // the same data as the compressed sample, but stored differently
+    plain->setSample( fsamp );
+
+    // not worth compressing, then empty
+    std::vector< Alembic::Util::int32_t > ivals( 3, 7 );
+    ints->setSample( ABCA::ArraySample( &ivals.front(), itype,
+                                        Alembic::Util::Dimensions( 3 ) ) );
+    ints->setSample( ABCA::ArraySample( &ivals.front(), itype,
+                                        Alembic::Util::Dimensions( 0 ) ) );
+
+    std::vector< std::string > svals( 100, "compress me" );
+    svals[50] = "";
+    strs->setSample( ABCA::ArraySample( &svals.front(), stype,
+                     Alembic::Util::Dimensions( svals.size() ) ) );
+
+    std::vector< std::wstring > wvals( 100, L"compress me" );
+    wstrs->setSample( ABCA::ArraySample( &wvals.front(), wtype,
+                      Alembic::Util::Dimensions( wvals.size() ) ) );
+}
+
+void testCompressedArrays()
+{
+    std::string archiveName = "compressedArrays.abc";
+    writeCompressedArchive( archiveName, 6 );
+    writeCompressedArchive( "uncompressedArrays.abc", -1 );
+
+    std::ifstream compressedFile( archiveName.c_str(), std::ios::binary );
+    compressedFile.seekg( 0, std::ios::end );
+    std::ifstream uncompressedFile( "uncompressedArrays.abc",
+                                    std::ios::binary );
+    uncompressedFile.seekg( 0, std::ios::end );
+    TESTING_ASSERT( compressedFile.tellg() < uncompressedFile.tellg() );
+
+    // only archives with compressed properties get the newer version
+    for ( int compressed = 0; compressed < 2; ++compressed )
+    {
+        Alembic::Ogawa::IArchive oa( compressed ? archiveName :
+                                     "uncompressedArrays.abc" );
+        Alembic::Util::int32_t version = -1;
+        oa.getGroup()->getData( 0, 0 )->read( 4, &version, 0, 0 );
+        TESTING_ASSERT( version == compressed );
+    }
+
+    AO::ReadArchive r;
+    ABCA::ArchiveReaderPtr a = r( archiveName );
+    ABCA::CompoundPropertyReaderPtr top = a->getTop()->getProperties();
+
+    ABCA::ArraySamplePtr plainSamp;
+    top->getArrayProperty( "plain" )->getSample( 0, plainSamp );
+
+    ABCA::ArrayPropertyReaderPtr floats = top->getArrayProperty( "floats" );
+    ABCA::ArraySamplePtr samp;
+    floats->getSample( 0, samp );
+    TESTING_ASSERT( samp->size() == 1000 );
+    TESTING_ASSERT( samp->getKey() == plainSamp->getKey() );
+    TESTING_ASSERT( memcmp( samp->getData(), plainSamp->getData(),
+                            12000 ) == 0 );
+
+    ABCA::ArraySampleKey key;
+    TESTING_ASSERT( floats->getKey( 0, key ) );
+    TESTING_ASSERT( key.numBytes == 12000 );
+    TESTING_ASSERT( key.digest == plainSamp->getKey().digest );
+
+    Alembic::Util::Dimensions dims;
+    floats->getDimensions( 0, dims );
+    TESTING_ASSERT( dims.numPoints() == 1000 );
+
+    std::vector< Alembic::Util::float64_t > doubles( 3000 );
+    floats->getAs( 0, &doubles.front(), Alembic::Util::kFloat64POD );
+    TESTING_ASSERT( doubles[2999] == 499.5 );
+
+    ABCA::ArrayPropertyReaderPtr ints = top->getArrayProperty( "ints" );
+    ints->getSample( 0, samp );
+    TESTING_ASSERT( samp->size() == 3 );
+    TESTING_ASSERT(
+        ( ( const Alembic::Util::int32_t * ) samp->getData() )[2] == 7 );
+    ints->getSample( 1, samp );
+    TESTING_ASSERT( samp->size() == 0 );
+
+    top->getArrayProperty( "strs" )->getSample( 0, samp );
+    TESTING_ASSERT( samp->size() == 100 );
+    const std::string * strData = ( const std::string * ) samp->getData();
+    TESTING_ASSERT( strData[0] == "compress me" );
+    TESTING_ASSERT( strData[50] == "" );
+    TESTING_ASSERT( strData[99] == "compress me" );
+
+    top->getArrayProperty( "wstrs" )->getSample( 0, samp );
+    TESTING_ASSERT( samp->size() == 100 );
+    const std::wstring * wstrData = ( const std::wstring * ) samp->getData();
+    TESTING_ASSERT( wstrData[0] == L"compress me" );
+    TESTING_ASSERT( wstrData[99] == L"compress me" );
+}
+
+void writeDeltaArchive( const std::string & iName,
+                        Alembic::Util::uint32_t iDeltaInterval,
+                        Alembic::Util::int8_t iCompressionHint,
+                        std::vector< std::vector< float > > & oFrames )
+{
+    AO::WriteArchive w;
+    ABCA::ArchiveWriterPtr a = w( iName, ABCA::MetaData() );
+    a->setCompressionHint( iCompressionHint );
+    ABCA::CompoundPropertyWriterPtr top = a->getTop()->getProperties();
+
+    ABCA::MetaData md;
+    if ( iDeltaInterval > 0 )
+    {
+        std::ostringstream strm;
+        strm << iDeltaInterval;
+        md.set( "deltaInterval", strm.str() );
+    }
+
+    ABCA::DataType ftype( Alembic::Util::kFloat32POD, 3 );
+    ABCA::ArrayPropertyWriterPtr points =
+        top->createArrayProperty( "points", md, ftype, 0 );
+
+    std::vector< float > vals( 3000 );
+    for ( std::size_t i = 0; i < vals.size(); ++i )
+    {
+        vals[i] = 0.25f * ( float ) i;
+    }
+
+    oFrames.clear();
+    for ( std::size_t frame = 0; frame < 20; ++frame )
+    {
+        // the first two are the same, and so are 6 and 7
+        if ( frame != 1 && frame != 7 )
+        {
+            for ( std::size_t j = 0; j < 50; ++j )
+            {
+                vals[( frame * 37 + j * 59 ) % vals.size()] += 1.0f;
+            }
+        }
+
+        // back to the first one, which has already been written
+        if ( frame == 10 )
+        {
+            vals = oFrames[0];
+        }
+
+        // fewer points means starting over
+        if ( frame == 15 )
+        {
+            vals.resize( 1500 );
+        }
+
+        oFrames.push_back( vals );
+        points->setSample( ABCA::ArraySample( &vals.front(), ftype,
+            Alembic::Util::Dimensions( vals.size() / 3 ) ) );
+    }
+}
+
+void testDeltaArrays()
+{
+    std::vector< std::vector< float > > frames;
+    writeDeltaArchive( "wholeArrays.abc", 0, -1, frames );
+    writeDeltaArchive( "deltaArrays.abc", 4, -1, frames );
+    writeDeltaArchive( "compressedDeltaArrays.abc", 8, 6, frames );
+
+    std::ifstream wholeFile( "wholeArrays.abc", std::ios::binary );
+    wholeFile.seekg( 0, std::ios::end );
+    std::ifstream deltaFile( "deltaArrays.abc", std::ios::binary );
+    deltaFile.seekg( 0, std::ios::end );
+    TESTING_ASSERT( deltaFile.tellg() * 2 < wholeFile.tellg() );
+
+    const char * names[3] = { "wholeArrays.abc", "deltaArrays.abc",
+                              "compressedDeltaArrays.abc" };
+    for ( std::size_t n = 0; n < 3; ++n )
+    {
+        AO::ReadArchive r;
+        ABCA::ArchiveReaderPtr a = r( names[n] );
+        ABCA::ArrayPropertyReaderPtr points =
+            a->getTop()->getProperties()->getArrayProperty( "points" );
+        TESTING_ASSERT( points->getNumSamples() == frames.size() );
+
+        // backwards, so the samples aren't read in the order they were
+        // written
+        std::vector< ABCA::index_t > indices;
+        for ( std::size_t i = frames.size(); i > 0; --i )
+        {
+            std::size_t index = i - 1;
+            indices.push_back( index );
+
+            ABCA::ArraySamplePtr samp;
+            points->getSample( index, samp );
+            TESTING_ASSERT( samp->size() * 3 == frames[index].size() );
+            TESTING_ASSERT( memcmp( samp->getData(), &frames[index].front(),
+                frames[index].size() * sizeof( float ) ) == 0 );
+
+            std::vector< Alembic::Util::float64_t > doubles(
+                frames[index].size() );
+            points->getAs( index, &doubles.front(),
+                           Alembic::Util::kFloat64POD );
+            TESTING_ASSERT( doubles.back() == frames[index].back() );
+
+            Alembic::Util::Dimensions dims;
+            points->getDimensions( index, dims );
+            TESTING_ASSERT( dims.numPoints() * 3 == frames[index].size() );
+        }
+
+        std::vector< ABCA::ArraySamplePtr > samps;
+        points->getSamples( indices, samps );
+        std::vector< float > all;
+        for ( std::size_t i = 0; i < indices.size(); ++i )
+        {
+            const std::vector< float > & frame = frames[indices[i]];
+            TESTING_ASSERT( memcmp( samps[i]->getData(), &frame.front(),
+                frame.size() * sizeof( float ) ) == 0 );
+            all.insert( all.end(), frame.begin(), frame.end() );
+        }
+
+        std::vector< float > allRead( all.size() );
+        points->getSamplesAs( indices, &allRead.front(),
+                              Alembic::Util::kFloat32POD );
+        TESTING_ASSERT( allRead == all );
+    }
+}
+
+void testCopyWithKeys()
+{
+    // copy the samples written by testDeltaArrays along with the keys read
+    // for them, so they don't have to be hashed again
+    const char * names[2] = { "wholeArrays.abc", "deltaArrays.abc" };
+    for ( std::size_t n = 0; n < 2; ++n )
+    {
+        AO::ReadArchive r;
+        ABCA::ArchiveReaderPtr ar = r( names[n] );
+        ABCA::ArrayPropertyReaderPtr points =
+            ar->getTop()->getProperties()->getArrayProperty( "points" );
+
+        {
+            AO::WriteArchive w;
+            ABCA::ArchiveWriterPtr a = w( "copiedArrays.abc",
+                                          ABCA::MetaData() );
+            ABCA::ArrayPropertyWriterPtr copy =
+                a->getTop()->getProperties()->createArrayProperty( "points",
+                    points->getMetaData(), points->getDataType(), 0 );
+
+            for ( std::size_t i = 0; i < points->getNumSamples(); ++i )
+            {
+                ABCA::ArraySamplePtr samp;
+                points->getSample( i, samp );
+
+                ABCA::ArraySampleKey key;
+                TESTING_ASSERT( points->getKey( i, key ) );
+                TESTING_ASSERT( key.numBytes == samp->getKey().numBytes );
+                TESTING_ASSERT( key.digest == samp->getKey().digest );
+                copy->setSample( *samp, key );
+            }
+
+            // the key has to describe the sample
+            ABCA::ArraySamplePtr samp;
+            points->getSample( 0, samp );
+            ABCA::ArraySampleKey key = samp->getKey();
+            key.numBytes += 4;
+            TESTING_ASSERT_THROW( copy->setSample( *samp, key ),
+                Alembic::Util::Exception );
+        }
+
+        AO::ReadArchive rc;
+        ABCA::ArchiveReaderPtr ac = rc( "copiedArrays.abc" );
+        ABCA::ArrayPropertyReaderPtr copied =
+            ac->getTop()->getProperties()->getArrayProperty( "points" );
+        TESTING_ASSERT( copied->getNumSamples() == points->getNumSamples() );
+        for ( std::size_t i = 0; i < copied->getNumSamples(); ++i )
+        {
+            ABCA::ArraySamplePtr samp, copiedSamp;
+            points->getSample( i, samp );
+            copied->getSample( i, copiedSamp );
+            TESTING_ASSERT( copiedSamp->getKey() == samp->getKey() );
+        }
+    }
+}
+
+//-*****************************************************************************
+// sets samples on one array and one scalar property from a pool thread
+class SetSamplesTask : public Task
+{
+public:
+    SetSamplesTask( ABCA::ArrayPropertyWriterPtr iArray,
+                    ABCA::ScalarPropertyWriterPtr iScalar )
+        : m_array( iArray ), m_scalar( iScalar ) {}
+
+    virtual void run()
+    {
+        for ( int32_t s = 0; s < 20000; ++s )
+        {
+            // every property writes the same samples, so they are shared
+            std::vector< int32_t > vals( 10 + s % 5, s );
+            m_array->setSample( ABCA::ArraySample( &vals.front(),
+                m_array->getDataType(), Dimensions( vals.size() ) ) );
+            m_scalar->setSample( &s );
+        }
+    }
+
+private:
+    ABCA::ArrayPropertyWriterPtr m_array;
+    ABCA::ScalarPropertyWriterPtr m_scalar;
+};
+
+//-*****************************************************************************
+void testConcurrentSets()
+{
+    // samples can be set on the properties of one archive from many threads,
+    // while objects are made and let go of on another
+    const std::size_t numProps = 8;
+    const std::size_t numChildren = 2000;
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w( "concurrentSets.abc", ABCA::MetaData() );
+        TESTING_ASSERT( a->supportsConcurrentWrites() );
+
+        ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+        ThreadPool pool( numProps );
+        for ( std::size_t i = 0; i < numProps; ++i )
+        {
+            std::ostringstream name;
+            name << i;
+            pool.add( TaskPtr( new SetSamplesTask(
+                parent->createArrayProperty( "array" + name.str(),
+                    ABCA::MetaData(), ABCA::DataType( kInt32POD ), 0 ),
+                parent->createScalarProperty( "scalar" + name.str(),
+                    ABCA::MetaData(), ABCA::DataType( kInt32POD ), 0 ) ) ) );
+        }
+
+        // destroying them freezes their groups, which writes to the stream
+        for ( std::size_t i = 0; i < numChildren; ++i )
+        {
+            std::ostringstream name;
+            name << "child" << i;
+            ABCA::ObjectWriterPtr child = a->getTop()->createChild(
+                ABCA::ObjectHeader( name.str(), ABCA::MetaData() ) );
+            ABCA::ArrayPropertyWriterPtr vals =
+                child->getProperties()->createArrayProperty( "vals",
+                    ABCA::MetaData(), ABCA::DataType( kInt32POD ), 0 );
+            std::vector< int32_t > data( 3, int32_t( i ) );
+            vals->setSample( ABCA::ArraySample( &data.front(),
+                vals->getDataType(), Dimensions( data.size() ) ) );
+        }
+
+        pool.wait();
+    }
+
+    AO::ReadArchive r;
+    ABCA::ArchiveReaderPtr a = r( "concurrentSets.abc" );
+    ABCA::CompoundPropertyReaderPtr parent = a->getTop()->getProperties();
+    for ( std::size_t i = 0; i < numProps; ++i )
+    {
+        std::ostringstream name;
+        name << i;
+        ABCA::ArrayPropertyReaderPtr ap =
+            parent->getArrayProperty( "array" + name.str() );
+        ABCA::ScalarPropertyReaderPtr sp =
+            parent->getScalarProperty( "scalar" + name.str() );
+        TESTING_ASSERT( ap->getNumSamples() == 20000 );
+        TESTING_ASSERT( sp->getNumSamples() == 20000 );
+
+        for ( int32_t s = 0; s < 20000; ++s )
+        {
+            ABCA::ArraySamplePtr samp;
+            ap->getSample( s, samp );
+            TESTING_ASSERT( samp->size() == std::size_t( 10 + s % 5 ) );
+            const int32_t * vals =
+                static_cast< const int32_t * >( samp->getData() );
+            TESTING_ASSERT( vals[0] == s && vals[samp->size() - 1] == s );
+
+            int32_t val = -1;
+            sp->getSample( s, &val );
+            TESTING_ASSERT( val == s );
+        }
+    }
+
+    TESTING_ASSERT( a->getTop()->getNumChildren() == numChildren );
+    for ( std::size_t i = 0; i < numChildren; ++i )
+    {
+        ABCA::ArraySamplePtr samp;
+        a->getTop()->getChild( i )->getProperties()->getArrayProperty(
+            "vals" )->getSample( 0, samp );
+        TESTING_ASSERT( samp->size() == 3 );
+        TESTING_ASSERT( static_cast< const int32_t * >(
+            samp->getData() )[2] == int32_t( i ) );
+    }
+}
+
 int main ( int argc, char *argv[] )
 {
     testEmptyArray();
@@ -1875,5 +2374,10 @@ int main ( int argc, char *argv[] )
     testExtentArrayStrings();
     testArrayStringsRepeats();
     testArraySamples();
+    testGetSamples();
+    testCompressedArrays();
+    testDeltaArrays();
+    testCopyWithKeys();
+    testConcurrentSets();
     return 0;
 }
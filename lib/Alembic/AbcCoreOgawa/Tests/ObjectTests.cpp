@@ -301,10 +301,159 @@ void testMetaData()
     }
 }
 
+void testPreloadHierarchy()
+{
+    std::string archiveName = "objectPreloadTest.abc";
+    {
+        AO::WriteArchive w;
+        AbcA::ArchiveWriterPtr a = w(archiveName, AbcA::MetaData());
+        AbcA::ObjectWriterPtr archive = a->getTop();
+
+        for (std::size_t i = 0; i < 20; ++i)
+        {
+            std::stringstream strm;
+            strm << i;
+            AbcA::ObjectWriterPtr child = archive->createChild(
+                AbcA::ObjectHeader(strm.str(), AbcA::MetaData()));
+
+            for (std::size_t j = 0; j < i; ++j)
+            {
+                std::stringstream jstrm;
+                jstrm << j;
+                AbcA::ObjectWriterPtr grandChild = child->createChild(
+                    AbcA::ObjectHeader(jstrm.str(), AbcA::MetaData()));
+
+                AbcA::CompoundPropertyWriterPtr cp =
+                    grandChild->getProperties()->createCompoundProperty(
+                        "outer", AbcA::MetaData())->createCompoundProperty(
+                        "inner", AbcA::MetaData());
+
+                AbcA::ScalarPropertyWriterPtr sp =
+                    cp->createScalarProperty("val", AbcA::MetaData(),
+                        AbcA::DataType(Alembic::Util::kUint32POD, 1), 0);
+
+                Alembic::Util::uint32_t val = i * 100 + j;
+                sp->setSample(&val);
+            }
+        }
+    }
+
+    // streams, and memory mapped
+    for (std::size_t k = 0; k < 2; ++k)
+    {
+        AO::ReadArchive r(4, k == 1, true);
+        AbcA::ArchiveReaderPtr a = r( archiveName );
+        AbcA::ObjectReaderPtr archive = a->getTop();
+        TESTING_ASSERT(archive->getNumChildren() == 20);
+
+        for (std::size_t i = 0; i < 20; ++i)
+        {
+            AbcA::ObjectReaderPtr child = archive->getChild(i);
+            TESTING_ASSERT(child->getNumChildren() == i);
+
+            for (std::size_t j = 0; j < i; ++j)
+            {
+                std::stringstream jstrm;
+                jstrm << j;
+                AbcA::ObjectReaderPtr grandChild = child->getChild(j);
+                TESTING_ASSERT(grandChild->getName() == jstrm.str());
+                TESTING_ASSERT(grandChild->getParent() == child);
+
+                AbcA::CompoundPropertyReaderPtr outer =
+                    grandChild->getProperties()->getCompoundProperty("outer");
+                AbcA::CompoundPropertyReaderPtr inner =
+                    outer->getCompoundProperty("inner");
+                TESTING_ASSERT(inner->getParent() == outer);
+                TESTING_ASSERT(inner->getObject() == grandChild);
+                TESTING_ASSERT(inner->getName() == "inner");
+
+                AbcA::ScalarPropertyReaderPtr sp =
+                    inner->getScalarProperty("val");
+                Alembic::Util::uint32_t val = 0;
+                sp->getSample(0, &val);
+                TESTING_ASSERT(val == i * 100 + j);
+            }
+        }
+    }
+}
+
+void testFindObject()
+{
+    // with and without an object index
+    for (std::size_t k = 0; k < 2; ++k)
+    {
+        std::string archiveName = "objectFindTest.abc";
+        {
+            AO::WriteArchive w(k == 1);
+            AbcA::ArchiveWriterPtr a = w(archiveName, AbcA::MetaData());
+            AbcA::ObjectWriterPtr parent = a->getTop();
+
+            // a deep hierarchy, with lots of siblings on the way down
+            for (std::size_t i = 0; i < 10; ++i)
+            {
+                AbcA::ObjectWriterPtr next;
+                for (std::size_t j = 0; j < 20; ++j)
+                {
+                    std::stringstream strm;
+                    strm << i << "_" << j;
+                    AbcA::MetaData m;
+                    m.set("depth", strm.str());
+                    AbcA::ObjectWriterPtr child = parent->createChild(
+                        AbcA::ObjectHeader(strm.str(), m));
+                    if (j == 13)
+                    {
+                        next = child;
+                    }
+                }
+                parent = next;
+            }
+
+            AbcA::ScalarPropertyWriterPtr sp =
+                parent->getProperties()->createScalarProperty("val",
+                    AbcA::MetaData(),
+                    AbcA::DataType(Alembic::Util::kUint32POD, 1), 0);
+
+            Alembic::Util::uint32_t val = 42;
+            sp->setSample(&val);
+        }
+
+        AO::ReadArchive r;
+        AbcA::ArchiveReaderPtr a = r( archiveName );
+
+        std::string path = "/0_13/1_13/2_13/3_13/4_13/5_13/6_13/7_13/8_13";
+        AbcA::ObjectReaderPtr obj = a->findObject(path + "/9_13");
+        TESTING_ASSERT(obj);
+        TESTING_ASSERT(obj->getName() == "9_13");
+        TESTING_ASSERT(obj->getFullName() == path + "/9_13");
+        TESTING_ASSERT(obj->getMetaData().get("depth") == "9_13");
+        TESTING_ASSERT(obj->getNumChildren() == 0);
+
+        Alembic::Util::uint32_t val = 0;
+        obj->getProperties()->getScalarProperty("val")->getSample(0, &val);
+        TESTING_ASSERT(val == 42);
+
+        AbcA::ObjectReaderPtr parent = obj->getParent();
+        TESTING_ASSERT(parent->getFullName() == path);
+        TESTING_ASSERT(parent->getNumChildren() == 20);
+        TESTING_ASSERT(parent->getChild(13)->getFullName() == path + "/9_13");
+
+        TESTING_ASSERT(a->findObject("/0_13/1_4")->getNumChildren() == 0);
+        TESTING_ASSERT(a->findObject("0_13/1_13/")->getFullName() ==
+                       "/0_13/1_13");
+        TESTING_ASSERT(a->findObject("/")->getFullName() == "/");
+        TESTING_ASSERT(!a->findObject("/0_13/1_13/nope"));
+        TESTING_ASSERT(!a->findObject("/0_13/1_4/2_13"));
+        TESTING_ASSERT(a->findObject("/0_1")->getParent()->getFullName()
+                       == "/");
+    }
+}
+
 int main ( int argc, char *argv[] )
 {
     testObjects();
     testChildObjects();
     testMetaData();
+    testPreloadHierarchy();
+    testFindObject();
     return 0;
 }
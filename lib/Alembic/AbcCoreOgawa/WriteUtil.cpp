@@ -37,10 +37,168 @@
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
 #include <Alembic/AbcCoreOgawa/AwImpl.h>
 
+#include <zlib.h>
+
+#include <algorithm>
+#include <cfloat>
+
 namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+namespace {
+
+// smaller samples aren't worth compressing
+const Util::uint64_t MIN_COMPRESSED_SIZE = 64;
+
+// the largest quantized value
+const double QUANTIZED_MAX = 65535.0;
+
+// the largest finite float16
+const float LARGEST_HALF = 65504.0f;
+
+//-*****************************************************************************
+// iData and iDataSize are what gets compressed, iNumBytes is the size of the
+// sample once it has been decoded, which only differs from iDataSize if
+// iPrecision reduced it or if it is a delta sample with iNumChanged points
+Ogawa::ODataPtr addCompressedData( Ogawa::OGroupPtr iGroup,
+                                   const Util::Digest & iDigest,
+                                   Util::uint64_t iNumBytes,
+                                   const void * iData,
+                                   Util::uint64_t iDataSize,
+                                   std::size_t iPodSize,
+                                   Util::int8_t iCompressionLevel,
+                                   DataPrecision iPrecision = kFullPrecision,
+                                   const Util::uint32_t * iNumChanged = NULL )
+{
+    Util::uint8_t encoding = kStoredEncoding;
+    const void * encoded = iData;
+    Util::uint64_t encodedSize = iDataSize;
+
+    std::vector< Util::uint8_t > shuffled;
+    std::vector< Util::uint8_t > compressed;
+
+    if ( iCompressionLevel > 0 && iDataSize >= MIN_COMPRESSED_SIZE )
+    {
+        const Util::uint8_t * src =
+            static_cast< const Util::uint8_t * >( iData );
+
+        // put the first byte of every POD together, then the second, etc.
+        // so the exponents of floats end up next to each other
+        if ( iPodSize > 1 && iDataSize % iPodSize == 0 )
+        {
+            std::size_t numPods = iDataSize / iPodSize;
+            shuffled.resize( iDataSize );
+            for ( std::size_t i = 0; i < numPods; ++i )
+            {
+                for ( std::size_t b = 0; b < iPodSize; ++b )
+                {
+                    shuffled[ b * numPods + i ] = src[ i * iPodSize + b ];
+                }
+            }
+            src = &shuffled.front();
+        }
+
+        uLongf compressedSize = compressBound( iDataSize );
+        compressed.resize( compressedSize );
+        if ( compress2( &compressed.front(), &compressedSize, src, iDataSize,
+                        iCompressionLevel ) == Z_OK &&
+             compressedSize < iDataSize )
+        {
+            encoding = shuffled.empty() ? kZlibEncoding :
+                kShuffledZlibEncoding;
+            encoded = &compressed.front();
+            encodedSize = compressedSize;
+        }
+    }
+
+    encoding |= iPrecision << 4;
+
+    if ( iNumChanged )
+    {
+        encoding |= kDeltaEncoding;
+
+        const void * datas[5] = { &iDigest, &iNumBytes, &encoding,
+                                  iNumChanged, encoded };
+        Util::uint64_t sizes[5] = { 16, 8, 1, 4, encodedSize };
+        return iGroup->addData( 5, sizes, datas );
+    }
+
+    const void * datas[4] = { &iDigest, &iNumBytes, &encoding, encoded };
+    Util::uint64_t sizes[4] = { 16, 8, 1, encodedSize };
+    return iGroup->addData( 4, sizes, datas );
+}
+
+//-*****************************************************************************
+// Reduces iNumFloats floats, made up of iExtent components, to iPrecision
+// in oData.  Returns false if they can't be, because they are out of range
+// for a half or aren't finite.
+bool reducePrecision( const float * iData,
+                      std::size_t iNumFloats,
+                      std::size_t iExtent,
+                      DataPrecision iPrecision,
+                      std::vector< Util::uint8_t > & oData )
+{
+    // NaNs fail both comparisons
+    float limit = iPrecision == kHalfPrecision ? LARGEST_HALF : FLT_MAX;
+    for ( std::size_t i = 0; i < iNumFloats; ++i )
+    {
+        if ( !( iData[i] >= -limit && iData[i] <= limit ) )
+        {
+            return false;
+        }
+    }
+
+    if ( iPrecision == kHalfPrecision )
+    {
+        oData.resize( iNumFloats * sizeof( Util::float16_t ) );
+        Util::float16_t * halfs =
+            reinterpret_cast< Util::float16_t * >( &oData.front() );
+        for ( std::size_t i = 0; i < iNumFloats; ++i )
+        {
+            halfs[i] = iData[i];
+        }
+        return true;
+    }
+
+    // the bounds of each component
+    std::vector< float > bounds( iExtent * 2 );
+    for ( std::size_t c = 0; c < iExtent; ++c )
+    {
+        bounds[c] = iData[c];
+        bounds[iExtent + c] = iData[c];
+    }
+
+    for ( std::size_t i = iExtent; i < iNumFloats; ++i )
+    {
+        std::size_t c = i % iExtent;
+        bounds[c] = std::min( bounds[c], iData[i] );
+        bounds[iExtent + c] = std::max( bounds[iExtent + c], iData[i] );
+    }
+
+    std::size_t boundsSize = bounds.size() * sizeof( float );
+    oData.resize( boundsSize + iNumFloats * sizeof( Util::uint16_t ) );
+    memcpy( &oData.front(), &bounds.front(), boundsSize );
+
+    Util::uint16_t * quantized =
+        reinterpret_cast< Util::uint16_t * >( &oData[boundsSize] );
+    for ( std::size_t i = 0; i < iNumFloats; ++i )
+    {
+        std::size_t c = i % iExtent;
+        double range = ( double ) bounds[iExtent + c] - bounds[c];
+        quantized[i] = 0;
+        if ( range > 0.0 )
+        {
+            quantized[i] = ( Util::uint16_t )( 0.5 +
+                ( iData[i] - bounds[c] ) / range * QUANTIZED_MAX );
+        }
+    }
+
+    return true;
+}
+
+} // End anonymous namespace
+
 //-*****************************************************************************
 void pushUint32WithHint( std::vector< Util::uint8_t > & ioData,
                          Util::uint32_t iVal, Util::uint32_t iHint )
@@ -149,13 +307,34 @@ void HashDimensions( const AbcA::Dimensions & iDims,
 
 //-*****************************************************************************
 WrittenSampleMap &
-GetWrittenSampleMap( AbcA::ArchiveWriterPtr iVal )
+GetWrittenSampleMap( AbcA::ArchiveWriterPtr iVal, bool iCompressed,
+                     DataPrecision iPrecision )
 {
     AwImpl *ptr = dynamic_cast<AwImpl*>( iVal.get() );
     ABCA_ASSERT( ptr, "NULL Impl Ptr" );
+    if ( iCompressed )
+    {
+        return ptr->getCompressedWrittenSampleMap( iPrecision );
+    }
     return ptr->getWrittenSampleMap();
 }
 
+//-*****************************************************************************
+Util::mutex & GetWriteMutex( AbcA::ArchiveWriterPtr iVal )
+{
+    AwImpl *ptr = dynamic_cast<AwImpl*>( iVal.get() );
+    ABCA_ASSERT( ptr, "NULL Impl Ptr" );
+    return ptr->getWriteMutex();
+}
+
+//-*****************************************************************************
+void UseCompression( AbcA::ArchiveWriterPtr iVal )
+{
+    AwImpl *ptr = dynamic_cast<AwImpl*>( iVal.get() );
+    ABCA_ASSERT( ptr, "NULL Impl Ptr" );
+    ptr->useCompression();
+}
+
 //-*****************************************************************************
 void WriteDimensions( Ogawa::OGroupPtr iGroup,
                       const AbcA::Dimensions & iDims,
@@ -183,7 +362,9 @@ WrittenSampleIDPtr
 WriteData( WrittenSampleMap &iMap,
            Ogawa::OGroupPtr iGroup,
            const AbcA::ArraySample &iSamp,
-           const AbcA::ArraySample::Key &iKey )
+           const AbcA::ArraySample::Key &iKey,
+           Util::int8_t iCompressionLevel,
+           DataPrecision iPrecision )
 {
 
     // Okay, need to actually store it.
@@ -225,9 +406,18 @@ WriteData( WrittenSampleMap &iMap,
             v.push_back(0);
         }
 
-        const void * datas[2] = { &iKey.digest, &v.front() };
-        Alembic::Util::uint64_t sizes[2] = { 16, v.size() };
-        dataPtr =  iGroup->addData( 2, sizes, datas );
+        if ( iCompressionLevel >= 0 )
+        {
+            dataPtr = addCompressedData( iGroup, iKey.digest, v.size(),
+                &v.front(), v.size(), sizeof( Util::int8_t ),
+                iCompressionLevel );
+        }
+        else
+        {
+            const void * datas[2] = { &iKey.digest, &v.front() };
+            Alembic::Util::uint64_t sizes[2] = { 16, v.size() };
+            dataPtr =  iGroup->addData( 2, sizes, datas );
+        }
     }
     else if ( dataType.getPod() == Alembic::Util::kWstringPOD )
     {
@@ -252,10 +442,41 @@ WriteData( WrittenSampleMap &iMap,
             v.push_back(0);
         }
 
-        const void * datas[2] = { &iKey.digest, &v.front() };
-        Alembic::Util::uint64_t sizes[2] = { 16,
-            v.size() * sizeof(Util::int32_t) };
-        dataPtr =  iGroup->addData( 2, sizes, datas );
+        if ( iCompressionLevel >= 0 )
+        {
+            Util::uint64_t numBytes = v.size() * sizeof( Util::int32_t );
+            dataPtr = addCompressedData( iGroup, iKey.digest, numBytes,
+                &v.front(), numBytes, sizeof( Util::int32_t ),
+                iCompressionLevel );
+        }
+        else
+        {
+            const void * datas[2] = { &iKey.digest, &v.front() };
+            Alembic::Util::uint64_t sizes[2] = { 16,
+                v.size() * sizeof(Util::int32_t) };
+            dataPtr =  iGroup->addData( 2, sizes, datas );
+        }
+    }
+    else if ( iCompressionLevel >= 0 )
+    {
+        std::vector< Util::uint8_t > reduced;
+        if ( iPrecision != kFullPrecision &&
+             dataType.getPod() == Alembic::Util::kFloat32POD &&
+             iKey.numBytes > 0 &&
+             reducePrecision( static_cast< const float * >( iSamp.getData() ),
+                              iKey.numBytes / sizeof( float ),
+                              dataType.getExtent(), iPrecision, reduced ) )
+        {
+            dataPtr = addCompressedData( iGroup, iKey.digest, iKey.numBytes,
+                &reduced.front(), reduced.size(), sizeof( Util::uint16_t ),
+                iCompressionLevel, iPrecision );
+        }
+        else
+        {
+            dataPtr = addCompressedData( iGroup, iKey.digest, iKey.numBytes,
+                iSamp.getData(), iKey.numBytes,
+                PODNumBytes( dataType.getPod() ), iCompressionLevel );
+        }
     }
     else
     {
@@ -273,6 +494,67 @@ WriteData( WrittenSampleMap &iMap,
     return writeID;
 }
 
+//-*****************************************************************************
+WrittenSampleIDPtr
+WriteDeltaData( Ogawa::OGroupPtr iGroup,
+                const AbcA::ArraySample &iSamp,
+                const AbcA::ArraySample::Key &iKey,
+                const std::vector< Util::uint8_t > &iPrevious,
+                Util::int8_t iCompressionLevel )
+{
+    const AbcA::DataType &dataType = iSamp.getDataType();
+    std::size_t numPoints = iSamp.getDimensions().numPoints();
+    std::size_t pointBytes = dataType.getNumBytes();
+
+    if ( dataType.getPod() == Alembic::Util::kStringPOD ||
+         dataType.getPod() == Alembic::Util::kWstringPOD ||
+         numPoints == 0 || numPoints > 0xffffffff ||
+         iPrevious.size() != iKey.numBytes ||
+         numPoints * pointBytes != iKey.numBytes )
+    {
+        return WrittenSampleIDPtr();
+    }
+
+    const Util::uint8_t * data =
+        static_cast< const Util::uint8_t * >( iSamp.getData() );
+
+    std::vector< Util::uint32_t > changed;
+    for ( std::size_t i = 0; i < numPoints; ++i )
+    {
+        if ( memcmp( &data[i * pointBytes], &iPrevious[i * pointBytes],
+                     pointBytes ) != 0 )
+        {
+            changed.push_back( i );
+        }
+    }
+
+    // the delta has to be well under the size of the whole sample to be
+    // worth reading the samples before it
+    std::size_t indicesSize = changed.size() * sizeof( Util::uint32_t );
+    std::size_t deltaSize = indicesSize + changed.size() * pointBytes;
+    if ( changed.empty() || deltaSize * 2 > iKey.numBytes )
+    {
+        return WrittenSampleIDPtr();
+    }
+
+    std::vector< Util::uint8_t > delta( deltaSize );
+    memcpy( &delta.front(), &changed.front(), indicesSize );
+    for ( std::size_t i = 0; i < changed.size(); ++i )
+    {
+        memcpy( &delta[indicesSize + i * pointBytes],
+                &data[changed[i] * pointBytes], pointBytes );
+    }
+
+    Util::uint32_t numChanged = changed.size();
+    Ogawa::ODataPtr dataPtr = addCompressedData( iGroup, iKey.digest,
+        iKey.numBytes, &delta.front(), deltaSize, sizeof( Util::uint32_t ),
+        iCompressionLevel < 0 ? 0 : iCompressionLevel, kFullPrecision,
+        &numChanged );
+
+    return WrittenSampleIDPtr( new WrittenSampleID( iKey, dataPtr,
+        dataType.getExtent() * numPoints ) );
+}
+
 //-*****************************************************************************
 void CopyWrittenData( Ogawa::OGroupPtr iGroup,
                       WrittenSampleIDPtr iRef )
@@ -291,6 +573,7 @@ void WritePropertyInfo( std::vector< Util::uint8_t > & ioData,
                     const AbcA::PropertyHeader &iHeader,
                     bool isScalarLike,
                     bool isHomogenous,
+                    bool isCompressed,
                     Util::uint32_t iTimeSamplingIndex,
                     Util::uint32_t iNumSamples,
                     Util::uint32_t iFirstChangedIndex,
@@ -327,6 +610,9 @@ void WritePropertyInfo( std::vector< Util::uint8_t > & ioData,
     // 0000 1111 1111 0000 0000 0000 0000 0000
     static const Util::uint32_t metaDataIndexMask = 0xff00000;
 
+    // 0001 0000 0000 0000 0000 0000 0000 0000
+    static const Util::uint32_t compressedMask = 0x10000000;
+
     std::string metaData = iHeader.getMetaData().serialize();
     Util::uint32_t metaDataSize = metaData.size();
 
@@ -410,6 +696,11 @@ void WritePropertyInfo( std::vector< Util::uint8_t > & ioData,
             info |= homogenousMask;
         }
 
+        if ( isCompressed )
+        {
+            info |= compressedMask;
+        }
+
         ABCA_ASSERT( iFirstChangedIndex <= iNumSamples &&
             iLastChangedIndex <= iNumSamples &&
             iFirstChangedIndex <= iLastChangedIndex,
@@ -490,6 +781,18 @@ void WriteObjectHeader( std::vector< Util::uint8_t > & ioData,
     }
 }
 
+//-*****************************************************************************
+void WriteObjectIndexEntry( std::vector< Util::uint8_t > & ioData,
+                            const AbcA::ObjectHeader &iHeader,
+                            Util::uint32_t iChildIndex,
+                            MetaDataMapPtr iMap )
+{
+    pushUint32WithHint( ioData, iChildIndex, 2 );
+
+    AbcA::ObjectHeader header( iHeader.getFullName(), iHeader.getMetaData() );
+    WriteObjectHeader( ioData, header, iMap );
+}
+
 //-*****************************************************************************
 void WriteTimeSampling( std::vector< Util::uint8_t > & ioData,
                     Util::uint32_t  iMaxSample,
@@ -57,7 +57,16 @@ void HashDimensions( const AbcA::Dimensions & iDims,
 
 //-*****************************************************************************
 WrittenSampleMap& GetWrittenSampleMap(
-    AbcA::ArchiveWriterPtr iArchive );
+    AbcA::ArchiveWriterPtr iArchive, bool iCompressed = false,
+    DataPrecision iPrecision = kFullPrecision );
+
+//-*****************************************************************************
+// held while a sample is being written, see AwImpl::getWriteMutex
+Util::mutex & GetWriteMutex( AbcA::ArchiveWriterPtr iArchive );
+
+//-*****************************************************************************
+// Lets the archive know one of its properties is compressed
+void UseCompression( AbcA::ArchiveWriterPtr iArchive );
 
 //-*****************************************************************************
 void
@@ -71,11 +80,29 @@ CopyWrittenData( Ogawa::OGroupPtr iParent,
                  WrittenSampleIDPtr iRef );
 
 //-*****************************************************************************
+// If iCompressionLevel is 0 to 9 the sample is written the way compressed
+// properties are, see PropertyHeaderAndFriends::isCompressed, and float32
+// samples are reduced to iPrecision when possible
 WrittenSampleIDPtr
 WriteData( WrittenSampleMap &iMap,
            Ogawa::OGroupPtr iGroup,
            const AbcA::ArraySample &iSamp,
-           const AbcA::ArraySample::Key &iKey );
+           const AbcA::ArraySample::Key &iKey,
+           Util::int8_t iCompressionLevel = -1,
+           DataPrecision iPrecision = kFullPrecision );
+
+//-*****************************************************************************
+// Writes iSamp as the points which changed since iPrevious, the bytes of the
+// sample before it, the way compressed samples are (see kDeltaEncoding).
+// Nothing is written, and NULL is returned, if that wouldn't be much smaller
+// than writing the whole sample.  Delta samples can't be shared with other
+// properties, so the returned ID isn't stored in a WrittenSampleMap.
+WrittenSampleIDPtr
+WriteDeltaData( Ogawa::OGroupPtr iGroup,
+                const AbcA::ArraySample &iSamp,
+                const AbcA::ArraySample::Key &iKey,
+                const std::vector< Util::uint8_t > &iPrevious,
+                Util::int8_t iCompressionLevel );
 
 //-*****************************************************************************
 void
@@ -83,6 +110,7 @@ WritePropertyInfo( std::vector< Util::uint8_t > & ioData,
                    const AbcA::PropertyHeader &iHeader,
                    bool isScalarLike,
                    bool isHomogenous,
+                   bool isCompressed,
                    Util::uint32_t iTimeSamplingIndex,
                    Util::uint32_t iNumSamples,
                    Util::uint32_t iFirstChangedIndex,
@@ -95,6 +123,15 @@ WriteObjectHeader( std::vector< Util::uint8_t > & ioData,
                    const AbcA::ObjectHeader &iHeader,
                    MetaDataMapPtr iMap );
 
+//-*****************************************************************************
+// the object index holds the index of the object within its parent followed
+// by the object header, with the full name in place of the name
+void
+WriteObjectIndexEntry( std::vector< Util::uint8_t > & ioData,
+                       const AbcA::ObjectHeader &iHeader,
+                       Util::uint32_t iChildIndex,
+                       MetaDataMapPtr iMap );
+
 //-*****************************************************************************
 void
 WriteTimeSampling( std::vector< Util::uint8_t > & ioData,
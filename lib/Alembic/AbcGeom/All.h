@@ -42,6 +42,7 @@
 #include <Alembic/AbcGeom/GeometryScope.h>
 
 #include <Alembic/AbcGeom/GeometryScope.h>
+#include <Alembic/AbcGeom/Precision.h>
 
 #include <Alembic/AbcGeom/Basis.h>
 #include <Alembic/AbcGeom/OCurves.h>
@@ -76,6 +77,8 @@
 #include <Alembic/AbcGeom/OSubD.h>
 #include <Alembic/AbcGeom/ISubD.h>
 
+#include <Alembic/AbcGeom/ISampleFetch.h>
+
 #include <Alembic/AbcGeom/XformOp.h>
 #include <Alembic/AbcGeom/XformSample.h>
 #include <Alembic/AbcGeom/OXform.h>
@@ -67,6 +67,67 @@ MeshTopologyVariance IPolyMeshSchema::getTopologyVariance() const
     return kConstantTopology;
 }
 
+//-*****************************************************************************
+void IPolyMeshSchema::get( IPolyMeshSchema::Sample &oSample,
+                           const Abc::ISampleSelector &iSS,
+                           Alembic::Util::ThreadPool &iPool ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPolyMeshSchema::get()" );
+
+    ISampleFetch fetch( iPool, this->getPtr()->getObject()->getArchive() );
+
+    fetch.add( m_positionsProperty, oSample.m_positions, iSS );
+    fetch.add( m_indicesProperty, oSample.m_indices, iSS );
+    fetch.add( m_countsProperty, oSample.m_counts, iSS );
+    fetch.add( m_selfBoundsProperty, oSample.m_selfBounds, iSS );
+
+    if ( m_velocitiesProperty && m_velocitiesProperty.getNumSamples() > 0 )
+    {
+        fetch.add( m_velocitiesProperty, oSample.m_velocities, iSS );
+    }
+
+    fetch.run();
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+bool IPolyMeshSchema::isTopologyChanged( const Abc::ISampleSelector &iSinceSS,
+                                         const Abc::ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPolyMeshSchema::isTopologyChanged()" );
+
+    return !m_indicesProperty.isSameSample( iSinceSS, iSS ) ||
+           !m_countsProperty.isSameSample( iSinceSS, iSS );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // Not all error handlers throw
+    return true;
+}
+
+//-*****************************************************************************
+void IPolyMeshSchema::getDeformed( IPolyMeshSchema::Sample &ioSample,
+                                   const Abc::ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPolyMeshSchema::getDeformed()" );
+
+    m_positionsProperty.get( ioSample.m_positions, iSS );
+
+    m_selfBoundsProperty.get( ioSample.m_selfBounds, iSS );
+
+    if ( m_velocitiesProperty && m_velocitiesProperty.getNumSamples() > 0 )
+    {
+        m_velocitiesProperty.get( ioSample.m_velocities, iSS );
+    }
+    else
+    {
+        ioSample.m_velocities.reset();
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 void IPolyMeshSchema::init( const Abc::Argument &iArg0,
                             const Abc::Argument &iArg1 )
@@ -42,6 +42,7 @@
 #include <Alembic/AbcGeom/IFaceSet.h>
 #include <Alembic/AbcGeom/IGeomParam.h>
 #include <Alembic/AbcGeom/IGeomBase.h>
+#include <Alembic/AbcGeom/ISampleFetch.h>
 
 namespace Alembic {
 namespace AbcGeom {
@@ -210,6 +211,11 @@ public:
         ALEMBIC_ABC_SAFE_CALL_END();
     }
 
+    //! Like get, but reads the properties of the sample at the same time
+    //! on iPool's threads, see ISampleFetch.
+    void get( Sample &oSample, const Abc::ISampleSelector &iSS,
+              Alembic::Util::ThreadPool &iPool ) const;
+
     Sample getValue( const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const
     {
         Sample smp;
@@ -217,6 +223,22 @@ public:
         return smp;
     }
 
+    //! Ask if the face indices or counts of the sample at iSS differ from
+    //! those of the sample at iSinceSS.  When the archive has keys stored
+    //! with the samples only those are compared, otherwise the face indices
+    //! and counts of both samples are read and hashed, see
+    //! IArrayProperty::isSameSample.
+    bool isTopologyChanged( const Abc::ISampleSelector &iSinceSS,
+                            const Abc::ISampleSelector &iSS ) const;
+
+    //! Get only the positions, velocities and self bounds of the sample at
+    //! iSS, leaving the face indices and counts of ioSample as they are.
+    //! When isTopologyChanged says the topology is the same as that of
+    //! the sample ioSample was last gotten at, this updates it the same
+    //! as get would, without reading or handing out new topology.
+    void getDeformed( Sample &ioSample,
+                      const Abc::ISampleSelector &iSS ) const;
+
     IV2fGeomParam getUVsParam() const
     {
         return m_uvsParam;
@@ -0,0 +1,124 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/ISampleFetch.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+void ISampleFetch::Read::run()
+{
+    try
+    {
+        AbcA::ReadStreamBindingPtr binding;
+        if ( m_archive )
+        {
+            binding = m_archive->bindReadStream();
+        }
+
+        read();
+    }
+    catch ( std::exception & e )
+    {
+        m_error = e.what();
+    }
+    catch ( ... )
+    {
+        m_error = "Unknown exception while fetching a sample";
+    }
+}
+
+//-*****************************************************************************
+ISampleFetch::ISampleFetch( Alembic::Util::ThreadPool & iPool,
+                            AbcA::ArchiveReaderPtr iArchive )
+    : m_pool( iPool )
+    , m_archive( iArchive )
+    , m_concurrent( iArchive && iArchive->supportsConcurrentReads() &&
+                    iPool.getNumThreads() > 0 )
+{
+}
+
+//-*****************************************************************************
+ISampleFetch::~ISampleFetch()
+{
+}
+
+//-*****************************************************************************
+void ISampleFetch::run()
+{
+    if ( m_reads.empty() )
+    {
+        return;
+    }
+
+    // the first read, usually the biggest, is done here while the pool
+    // does the rest, waiting on the group only waits for these reads, and
+    // does any of them the pool hasn't got to yet here
+    if ( m_concurrent )
+    {
+        Alembic::Util::TaskGroup group( m_pool );
+        for ( std::size_t i = 1; i < m_reads.size(); ++i )
+        {
+            group.add( m_reads[i] );
+        }
+
+        m_reads[0]->run();
+        group.wait();
+    }
+    else
+    {
+        for ( std::size_t i = 0; i < m_reads.size(); ++i )
+        {
+            m_reads[i]->run();
+        }
+    }
+
+    std::vector< ReadPtr > reads;
+    reads.swap( m_reads );
+    for ( std::size_t i = 0; i < reads.size(); ++i )
+    {
+        if ( !reads[i]->getError().empty() )
+        {
+            ABCA_THROW( reads[i]->getError() );
+        }
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
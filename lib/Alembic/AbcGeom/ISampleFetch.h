@@ -0,0 +1,137 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_AbcGeom_ISampleFetch_h_
+#define _Alembic_AbcGeom_ISampleFetch_h_
+
+#include <Alembic/AbcGeom/Foundation.h>
+#include <Alembic/Util/ThreadPool.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! Reads the properties which make up one sample of a schema at the same
+//! time instead of one after another, which on cold reads cuts the time to
+//! get a sample down to about that of its biggest property.  Reads are
+//! queued with add and all done by run, which returns once every one of
+//! them is.
+//! Archives which can't be read from several threads at once (see
+//! AbcCoreAbstract::ArchiveReader::supportsConcurrentReads) are read one
+//! property after another on the calling thread.  Ogawa archives read
+//! through file streams only read as many properties at once as they have
+//! streams, IFactory::setOgawaNumStreams or kMemoryMappedFiles lift that.
+class ISampleFetch : Alembic::Util::noncopyable
+{
+public:
+    //! The reads are spread across iPool's threads and the calling thread.
+    //! run only waits for its own reads, and can be called from one of
+    //! iPool's tasks.
+    ISampleFetch( Alembic::Util::ThreadPool & iPool,
+                  AbcA::ArchiveReaderPtr iArchive );
+
+    ~ISampleFetch();
+
+    //! Queues up iProp.get( oSample, iSS ), iProp can be any property which
+    //! has such a get.  oSample has to stay around until run returns.
+    template <class PROPERTY, class SAMPLE>
+    void add( const PROPERTY & iProp, SAMPLE & oSample,
+              const Abc::ISampleSelector & iSS )
+    {
+        m_reads.push_back( ReadPtr(
+            new PropertyRead< PROPERTY, SAMPLE >( m_archive, iProp, oSample,
+                                                  iSS ) ) );
+    }
+
+    //! Does every read queued since the last run, throws the first error
+    //! any of them ran into once they are all done.
+    void run();
+
+private:
+    // a queued read, which holds onto what it throws instead of throwing
+    // it into the pool, and reads everything it needs through one stream
+    class Read : public Alembic::Util::Task
+    {
+    public:
+        explicit Read( AbcA::ArchiveReaderPtr iArchive )
+            : m_archive( iArchive ) {}
+
+        virtual void run();
+        const std::string & getError() const { return m_error; }
+
+    protected:
+        virtual void read() = 0;
+
+    private:
+        AbcA::ArchiveReaderPtr m_archive;
+        std::string m_error;
+    };
+
+    typedef Alembic::Util::shared_ptr< Read > ReadPtr;
+
+    template <class PROPERTY, class SAMPLE>
+    class PropertyRead : public Read
+    {
+    public:
+        PropertyRead( AbcA::ArchiveReaderPtr iArchive, const PROPERTY & iProp,
+                      SAMPLE & oSample, const Abc::ISampleSelector & iSS )
+            : Read( iArchive ), m_prop( iProp ), m_sample( oSample ),
+              m_selector( iSS ) {}
+
+    protected:
+        virtual void read() { m_prop.get( m_sample, m_selector ); }
+
+    private:
+        PROPERTY m_prop;
+        SAMPLE & m_sample;
+        Abc::ISampleSelector m_selector;
+    };
+
+    Alembic::Util::ThreadPool & m_pool;
+    AbcA::ArchiveReaderPtr m_archive;
+    bool m_concurrent;
+    std::vector< ReadPtr > m_reads;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
@@ -168,6 +168,78 @@ void ISubDSchema::get( ISubDSchema::Sample &oSample,
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+void ISubDSchema::get( ISubDSchema::Sample &oSample,
+                       const Abc::ISampleSelector &iSS,
+                       Alembic::Util::ThreadPool &iPool ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "ISubDSchema::get()" );
+
+    ISampleFetch fetch( iPool, this->getPtr()->getObject()->getArchive() );
+
+    fetch.add( m_positionsProperty, oSample.m_positions, iSS );
+    fetch.add( m_faceIndicesProperty, oSample.m_faceIndices, iSS );
+    fetch.add( m_faceCountsProperty, oSample.m_faceCounts, iSS );
+
+    oSample.m_faceVaryingInterpolateBoundary = 0;
+    if ( m_faceVaryingInterpolateBoundaryProperty )
+    {
+        fetch.add( m_faceVaryingInterpolateBoundaryProperty,
+                   oSample.m_faceVaryingInterpolateBoundary, iSS );
+    }
+
+    oSample.m_faceVaryingPropagateCorners = 0;
+    if ( m_faceVaryingPropagateCornersProperty )
+    {
+        fetch.add( m_faceVaryingPropagateCornersProperty,
+                   oSample.m_faceVaryingPropagateCorners, iSS );
+    }
+
+    oSample.m_interpolateBoundary = 0;
+    if ( m_interpolateBoundaryProperty )
+    {
+        fetch.add( m_interpolateBoundaryProperty,
+                   oSample.m_interpolateBoundary, iSS );
+    }
+
+    fetch.add( m_selfBoundsProperty, oSample.m_selfBounds, iSS );
+
+    if ( m_creaseIndicesProperty )
+    { fetch.add( m_creaseIndicesProperty, oSample.m_creaseIndices, iSS ); }
+
+    if ( m_creaseLengthsProperty )
+    { fetch.add( m_creaseLengthsProperty, oSample.m_creaseLengths, iSS ); }
+
+    if ( m_creaseSharpnessesProperty )
+    {
+        fetch.add( m_creaseSharpnessesProperty, oSample.m_creaseSharpnesses,
+                   iSS );
+    }
+
+    if ( m_cornerIndicesProperty )
+    { fetch.add( m_cornerIndicesProperty, oSample.m_cornerIndices, iSS ); }
+
+    if ( m_cornerSharpnessesProperty )
+    {
+        fetch.add( m_cornerSharpnessesProperty, oSample.m_cornerSharpnesses,
+                   iSS );
+    }
+
+    if ( m_holesProperty )
+    { fetch.add( m_holesProperty, oSample.m_holes, iSS ); }
+
+    oSample.m_subdScheme = "catmull-clark";
+    if ( m_subdSchemeProperty )
+    { fetch.add( m_subdSchemeProperty, oSample.m_subdScheme, iSS ); }
+
+    if ( m_velocitiesProperty && m_velocitiesProperty.getNumSamples() > 0 )
+    { fetch.add( m_velocitiesProperty, oSample.m_velocities, iSS ); }
+
+    fetch.run();
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 const ISubDSchema &
 ISubDSchema::operator=(const ISubDSchema & rhs)
@@ -201,6 +273,73 @@ ISubDSchema::operator=(const ISubDSchema & rhs)
     return *this;
 }
 
+//-*****************************************************************************
+bool ISubDSchema::isTopologyChanged( const Abc::ISampleSelector &iSinceSS,
+                                     const Abc::ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "ISubDSchema::isTopologyChanged()" );
+
+    if ( !m_faceIndicesProperty.isSameSample( iSinceSS, iSS ) ||
+         !m_faceCountsProperty.isSameSample( iSinceSS, iSS ) )
+    {
+        return true;
+    }
+
+    Abc::IArrayProperty arrays[] = {
+        m_creaseIndicesProperty, m_creaseLengthsProperty,
+        m_creaseSharpnessesProperty, m_cornerIndicesProperty,
+        m_cornerSharpnessesProperty, m_holesProperty };
+
+    for ( size_t i = 0; i < sizeof( arrays ) / sizeof( arrays[0] ); ++i )
+    {
+        if ( arrays[i] && !arrays[i].isSameSample( iSinceSS, iSS ) )
+        {
+            return true;
+        }
+    }
+
+    // the scalars are small enough to just read
+    Abc::IInt32Property ints[] = {
+        m_faceVaryingInterpolateBoundaryProperty,
+        m_faceVaryingPropagateCornersProperty,
+        m_interpolateBoundaryProperty };
+
+    for ( size_t i = 0; i < sizeof( ints ) / sizeof( ints[0] ); ++i )
+    {
+        if ( ints[i] && ints[i].getValue( iSinceSS ) !=
+             ints[i].getValue( iSS ) )
+        {
+            return true;
+        }
+    }
+
+    return m_subdSchemeProperty && m_subdSchemeProperty.getValue( iSinceSS ) !=
+        m_subdSchemeProperty.getValue( iSS );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // Not all error handlers throw
+    return true;
+}
+
+//-*****************************************************************************
+void ISubDSchema::getDeformed( ISubDSchema::Sample &ioSample,
+                               const Abc::ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "ISubDSchema::getDeformed()" );
+
+    m_positionsProperty.get( ioSample.m_positions, iSS );
+
+    m_selfBoundsProperty.get( ioSample.m_selfBounds, iSS );
+
+    if ( m_velocitiesProperty && m_velocitiesProperty.getNumSamples() > 0 )
+    { m_velocitiesProperty.get( ioSample.m_velocities, iSS ); }
+    else
+    { ioSample.m_velocities.reset(); }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 void ISubDSchema::init( const Abc::Argument &iArg0,
                         const Abc::Argument &iArg1 )
@@ -42,6 +42,7 @@
 #include <Alembic/AbcGeom/IGeomParam.h>
 #include <Alembic/AbcGeom/IFaceSet.h>
 #include <Alembic/AbcGeom/IGeomBase.h>
+#include <Alembic/AbcGeom/ISampleFetch.h>
 
 namespace Alembic {
 namespace AbcGeom {
@@ -266,6 +267,11 @@ public:
     void get( Sample &iSamp,
               const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const;
 
+    //! Like get, but reads the properties of the sample at the same time
+    //! on iPool's threads, see ISampleFetch.
+    void get( Sample &oSample, const Abc::ISampleSelector &iSS,
+              Alembic::Util::ThreadPool &iPool ) const;
+
     Sample getValue( const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const
     {
         Sample smp;
@@ -273,6 +279,20 @@ public:
         return smp;
     }
 
+    //! Ask if anything but the positions, velocities or self bounds of the
+    //! sample at iSS differs from the sample at iSinceSS, that is the faces,
+    //! creases, corners, holes, boundary rules or scheme.  The array
+    //! properties have the keys stored with their samples compared, or if
+    //! the archive doesn't store keys, both of their samples read and
+    //! hashed, see IArrayProperty::isSameSample.
+    bool isTopologyChanged( const Abc::ISampleSelector &iSinceSS,
+                            const Abc::ISampleSelector &iSS ) const;
+
+    //! Get only the positions, velocities and self bounds of the sample at
+    //! iSS, leaving the rest of ioSample as it is, see isTopologyChanged.
+    void getDeformed( Sample &ioSample,
+                      const Abc::ISampleSelector &iSS ) const;
+
     Abc::IInt32ArrayProperty getFaceCountsProperty() const
     { return m_faceCountsProperty; }
     Abc::IInt32ArrayProperty getFaceIndicesProperty() const
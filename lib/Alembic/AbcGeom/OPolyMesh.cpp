@@ -61,6 +61,13 @@ void OPolyMeshSchema::set( const Sample &iSamp )
         }
     }
 
+    // the UVs and normals are stored like the positions
+    AbcA::MetaData storageMetaData;
+    if ( m_deltaInterval > 0 )
+    {
+        SetDeltaInterval( storageMetaData, m_deltaInterval );
+    }
+
     // do we need to create uvs?
     if ( iSamp.getUVs() && !m_uvsParam )
     {
@@ -78,7 +85,8 @@ void OPolyMeshSchema::set( const Sample &iSamp )
             // UVs are indexed
             m_uvsParam = OV2fGeomParam( this->getPtr(), "uv", true,
                                    empty.getScope(), 1,
-                                   this->getTimeSampling() );
+                                   this->getTimeSampling(),
+                                   storageMetaData );
         }
         else
         {
@@ -88,9 +96,12 @@ void OPolyMeshSchema::set( const Sample &iSamp )
             // UVs are not indexed
             m_uvsParam = OV2fGeomParam( this->getPtr(), "uv", false,
                                    empty.getScope(), 1,
-                                   this->getTimeSampling() );
+                                   this->getTimeSampling(),
+                                   storageMetaData );
         }
 
+        m_uvsParam.getValueProperty().getPtr()->setPrecision( m_precision );
+
         size_t numSamples = m_positionsProperty.getNumSamples();
 
         // set all the missing samples
@@ -116,7 +127,8 @@ void OPolyMeshSchema::set( const Sample &iSamp )
 
             // normals are indexed
             m_normalsParam = ON3fGeomParam( this->getPtr(), "N", true,
-                empty.getScope(), 1, this->getTimeSampling() );
+                empty.getScope(), 1, this->getTimeSampling(),
+                storageMetaData );
         }
         else
         {
@@ -126,9 +138,13 @@ void OPolyMeshSchema::set( const Sample &iSamp )
             // normals are not indexed
             m_normalsParam = ON3fGeomParam( this->getPtr(), "N", false,
                                         empty.getScope(), 1,
-                                        this->getTimeSampling() );
+                                        this->getTimeSampling(),
+                                        storageMetaData );
         }
 
+        m_normalsParam.getValueProperty().getPtr()->setPrecision(
+            m_precision );
+
         size_t numSamples = m_positionsProperty.getNumSamples();
 
         // set all the missing samples
@@ -274,10 +290,24 @@ void OPolyMeshSchema::init( uint32_t iTsIdx )
 {
     ALEMBIC_ABC_SAFE_CALL_BEGIN( "OPolyMeshSchema::init()" );
 
+    AbcA::CompoundPropertyWriterPtr _this = this->getPtr();
+
+    // until setPrecision asks for less
+    m_precision = kFullPrecision;
+
+    m_deltaInterval = GetDeltaInterval( _this->getMetaData() );
+    if ( m_deltaInterval == 0 )
+    {
+        m_deltaInterval =
+            GetDeltaInterval( _this->getObject()->getMetaData() );
+    }
+
     AbcA::MetaData mdata;
     SetGeometryScope( mdata, kVertexScope );
-
-    AbcA::CompoundPropertyWriterPtr _this = this->getPtr();
+    if ( m_deltaInterval > 0 )
+    {
+        SetDeltaInterval( mdata, m_deltaInterval );
+    }
 
     m_positionsProperty = Abc::OP3fArrayProperty( _this, "P", mdata, iTsIdx );
 
@@ -290,6 +320,24 @@ void OPolyMeshSchema::init( uint32_t iTsIdx )
     ALEMBIC_ABC_SAFE_CALL_END_RESET();
 }
 
+//-*****************************************************************************
+void OPolyMeshSchema::setPrecision( Precision iPrecision )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "OPolyMeshSchema::setPrecision()" );
+
+    ABCA_ASSERT( m_positionsProperty.getNumSamples() == 0,
+                 "Precision must be set before the first sample" );
+
+    // archives which can't store it keep the full precision
+    m_precision = kFullPrecision;
+    if ( m_positionsProperty.getPtr()->setPrecision( iPrecision ) )
+    {
+        m_precision = iPrecision;
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 bool
 OPolyMeshSchema::hasFaceSet( const std::string &iFaceSetName )
@@ -40,6 +40,7 @@
 #include <Alembic/AbcGeom/Foundation.h>
 #include <Alembic/AbcGeom/SchemaInfoDeclarations.h>
 #include <Alembic/AbcGeom/OFaceSet.h>
+#include <Alembic/AbcGeom/Precision.h>
 #include <Alembic/AbcGeom/OGeomParam.h>
 #include <Alembic/AbcGeom/OGeomBase.h>
 
@@ -152,7 +153,7 @@ public:
 
     //! The default constructor creates an empty OPolyMeshSchema
     //! ...
-    OPolyMeshSchema() {}
+    OPolyMeshSchema() : m_precision( kFullPrecision ), m_deltaInterval( 0 ) {}
 
     //! This templated, primary constructor creates a new poly mesh writer.
     //! The first argument is any Abc (or AbcCoreAbstract) object
@@ -161,6 +162,9 @@ public:
     //! inheritance is also derived.  The remaining optional arguments
     //! can be used to override the ErrorHandlerPolicy, to specify
     //! MetaData, and to set TimeSamplingType.
+    //! If the MetaData of this schema, or of its object, has a delta
+    //! interval (see Abc::SetDeltaInterval) the positions, UVs and normals
+    //! are written with it.
     template <class CPROP_PTR>
     OPolyMeshSchema( CPROP_PTR iParent,
                      const std::string &iName,
@@ -278,6 +282,9 @@ public:
 
         m_faceSets.clear();
 
+        m_precision = kFullPrecision;
+        m_deltaInterval = 0;
+
         OGeomBaseSchema<PolyMeshSchemaInfo>::reset();
     }
 
@@ -298,6 +305,17 @@ public:
     OFaceSet getFaceSet( const std::string &iFaceSetName );
     bool hasFaceSet( const std::string &iFaceSetName );
 
+    //! Writes the positions, UVs and normals with iPrecision, which is
+    //! lossy.  It has to be called before the first sample is set.
+    //! Archives which can't store it keep full precision, see getPrecision.
+    void setPrecision( Precision iPrecision );
+
+    //! The precision the positions, UVs and normals are written with.
+    Precision getPrecision() const { return m_precision; }
+
+    //! The delta interval the positions, UVs and normals are written with.
+    uint32_t getDeltaInterval() const { return m_deltaInterval; }
+
     //! unspecified-bool-type operator overload.
     //! ...
     ALEMBIC_OVERRIDE_OPERATOR_BOOL( OPolyMeshSchema::valid() );
@@ -316,6 +334,10 @@ protected:
     OV2fGeomParam m_uvsParam;
     ON3fGeomParam m_normalsParam;
 
+    // for the positions, and the UVs and normals once they are created
+    Precision m_precision;
+    uint32_t m_deltaInterval;
+
     // self and child bounds and ArbGeomParams and UserProperties
     // all come from OGeomBaseSchema
 };
@@ -59,8 +59,11 @@
 // Alembic Includes
 #include <Alembic/AbcGeom/All.h>
 #include <Alembic/AbcCoreHDF5/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
 
 // Other includes
+#include <algorithm>
+#include <fstream>
 #include <iostream>
 #include <stdio.h>
 #include <stdlib.h>
@@ -341,6 +344,434 @@ void optPropTest()
     }
 }
 
+//-*****************************************************************************
+// writes a grid with the given precision and returns the size of the file
+size_t writePrecisionMesh( const std::string &iName, Precision iPrecision )
+{
+    const size_t gridSize = 64;
+
+    std::vector< V3f > verts;
+    std::vector< N3f > normals;
+    std::vector< V2f > uvs;
+    for ( size_t i = 0; i < gridSize; ++i )
+    {
+        for ( size_t j = 0; j < gridSize; ++j )
+        {
+            float u = ( float ) i / ( gridSize - 1 );
+            float v = ( float ) j / ( gridSize - 1 );
+            verts.push_back( V3f( 10.0f * u - 5.0f, sinf( 3.0f * u + v ),
+                                  20.0f * v + 100.0f ) );
+            normals.push_back( N3f( u, v, 1.0f ).normalized() );
+            uvs.push_back( V2f( u, v ) );
+        }
+    }
+
+    std::vector< int32_t > indices;
+    std::vector< int32_t > counts;
+    for ( size_t i = 0; i + 1 < gridSize; ++i )
+    {
+        for ( size_t j = 0; j + 1 < gridSize; ++j )
+        {
+            indices.push_back( i * gridSize + j );
+            indices.push_back( ( i + 1 ) * gridSize + j );
+            indices.push_back( ( i + 1 ) * gridSize + j + 1 );
+            indices.push_back( i * gridSize + j + 1 );
+            counts.push_back( 4 );
+        }
+    }
+
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+        OPolyMesh meshyObj( OObject( archive, kTop ), "mesh" );
+        OPolyMeshSchema &mesh = meshyObj.getSchema();
+        mesh.setPrecision( iPrecision );
+        TESTING_ASSERT( mesh.getPrecision() == iPrecision );
+
+        OPolyMeshSchema::Sample mesh_samp(
+            V3fArraySample( verts ),
+            Int32ArraySample( indices ),
+            Int32ArraySample( counts ),
+            OV2fGeomParam::Sample( V2fArraySample( uvs ), kVertexScope ),
+            ON3fGeomParam::Sample( N3fArraySample( normals ), kVertexScope ) );
+        mesh.set( mesh_samp );
+    }
+
+    {
+        IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), iName );
+
+        IPolyMesh meshyObj( IObject( archive, kTop ), "mesh" );
+        IPolyMeshSchema &mesh = meshyObj.getSchema();
+
+        IPolyMeshSchema::Sample samp = mesh.getValue();
+        P3fArraySamplePtr readVerts = samp.getPositions();
+        TESTING_ASSERT( readVerts->size() == verts.size() );
+        TESTING_ASSERT( samp.getFaceIndices()->size() == indices.size() );
+
+        V2fArraySamplePtr readUVs =
+            mesh.getUVsParam().getExpandedValue().getVals();
+        N3fArraySamplePtr readNormals =
+            mesh.getNormalsParam().getExpandedValue().getVals();
+        TESTING_ASSERT( readUVs->size() == uvs.size() );
+        TESTING_ASSERT( readNormals->size() == normals.size() );
+
+        // half has 11 bits of precision, quantized 16 bits over the range
+        float tolerance = 0.0f;
+        if ( iPrecision == kHalfPrecision ) { tolerance = 1.0f / 1024.0f; }
+        else if ( iPrecision == kQuantizedPrecision )
+        {
+            tolerance = 1.0f / 65536.0f;
+        }
+
+        for ( size_t i = 0; i < verts.size(); ++i )
+        {
+            for ( size_t c = 0; c < 3; ++c )
+            {
+                // relative to the value for half, to the range for quantized
+                float scale = iPrecision == kHalfPrecision ?
+                    fabsf( verts[i][c] ) : 200.0f;
+                TESTING_ASSERT( fabsf( ( *readVerts )[i][c] - verts[i][c] ) <=
+                                tolerance * scale );
+                TESTING_ASSERT( fabsf( ( *readNormals )[i][c] -
+                                       normals[i][c] ) <= tolerance );
+            }
+
+            TESTING_ASSERT( ( ( *readUVs )[i] - uvs[i] ).length() <=
+                            tolerance * 2.0f );
+        }
+    }
+
+    std::ifstream file( iName.c_str(), std::ios::binary | std::ios::ate );
+    return file.tellg();
+}
+
+//-*****************************************************************************
+void precisionTest()
+{
+    size_t fullSize = writePrecisionMesh( "meshFullPrecision.abc",
+                                          kFullPrecision );
+    size_t halfSize = writePrecisionMesh( "meshHalfPrecision.abc",
+                                          kHalfPrecision );
+    size_t quantizedSize = writePrecisionMesh( "meshQuantizedPrecision.abc",
+                                               kQuantizedPrecision );
+
+    // the positions, normals and UVs are most of the file
+    TESTING_ASSERT( halfSize < fullSize * 3 / 4 );
+    TESTING_ASSERT( quantizedSize < fullSize * 3 / 4 );
+
+    // the precision isn't taken from MetaData, so copying the MetaData of
+    // a reduced property doesn't reduce the copy
+    std::vector< V3f > verts( 10, V3f( 0.1f, 0.2f, 1000.7f ) );
+    {
+        AbcA::MetaData md;
+        md.set( "precision", "half" );
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+                          "precisionMetaData.abc" );
+        OP3fArrayProperty prop( OObject( archive, kTop ).getProperties(),
+                                "P", md );
+        prop.set( verts );
+
+        // and it has to be asked for before the first sample
+        OPolyMesh meshyObj( OObject( archive, kTop ), "mesh" );
+        OPolyMeshSchema &mesh = meshyObj.getSchema();
+        std::vector< int32_t > indices( 3, 0 );
+        std::vector< int32_t > counts( 1, 3 );
+        mesh.set( OPolyMeshSchema::Sample( V3fArraySample( verts ),
+            Int32ArraySample( indices ), Int32ArraySample( counts ) ) );
+        TESTING_ASSERT_THROW( mesh.setPrecision( kHalfPrecision ),
+                              Alembic::Util::Exception );
+        TESTING_ASSERT( mesh.getPrecision() == kFullPrecision );
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(),
+                      "precisionMetaData.abc" );
+    P3fArraySamplePtr samp = IP3fArrayProperty(
+        IObject( archive, kTop ).getProperties(), "P" ).getValue();
+    TESTING_ASSERT( ( *samp )[9] == verts[9] );
+}
+
+//-*****************************************************************************
+// a full and a reduced precision copy of the same positions read through one
+// cache don't get mixed up
+void precisionCacheTest()
+{
+    std::string name = "meshPrecisionCache.abc";
+
+    std::vector< V3f > verts;
+    for ( size_t i = 0; i < 100; ++i )
+    {
+        verts.push_back( V3f( 0.1f * i + 0.01f, 0.3f * i, 1000.7f ) );
+    }
+
+    std::vector< int32_t > indices;
+    std::vector< int32_t > counts;
+    for ( size_t i = 0; i + 2 < verts.size(); i += 3 )
+    {
+        indices.push_back( i );
+        indices.push_back( i + 1 );
+        indices.push_back( i + 2 );
+        counts.push_back( 3 );
+    }
+
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        V3fArraySample vertSamp( verts );
+        OPolyMeshSchema::Sample samp( vertSamp, Int32ArraySample( indices ),
+                                      Int32ArraySample( counts ) );
+
+        OPolyMesh fullObj( OObject( archive, kTop ), "full" );
+        fullObj.getSchema().set( samp );
+
+        OPolyMesh halfObj( OObject( archive, kTop ), "half" );
+        halfObj.getSchema().setPrecision( kHalfPrecision );
+        halfObj.getSchema().set( samp );
+    }
+
+    AbcA::ReadArraySampleCachePtr cache =
+        Alembic::AbcCoreHDF5::CreateCache();
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name,
+                      ErrorHandler::kThrowPolicy, cache );
+
+    IPolyMeshSchema full = IPolyMesh( IObject( archive, kTop ),
+                                      "full" ).getSchema();
+    IPolyMeshSchema half = IPolyMesh( IObject( archive, kTop ),
+                                      "half" ).getSchema();
+
+    AbcA::ArraySampleKey fullKey;
+    AbcA::ArraySampleKey halfKey;
+    TESTING_ASSERT( full.getPositionsProperty().getKey( fullKey ) );
+    TESTING_ASSERT( half.getPositionsProperty().getKey( halfKey ) );
+    TESTING_ASSERT( !( fullKey == halfKey ) );
+
+    P3fArraySamplePtr fullVerts = full.getValue().getPositions();
+    P3fArraySamplePtr halfVerts = half.getValue().getPositions();
+    TESTING_ASSERT( fullVerts != halfVerts );
+
+    bool differs = false;
+    for ( size_t i = 0; i < verts.size(); ++i )
+    {
+        TESTING_ASSERT( ( *fullVerts )[i] == verts[i] );
+        differs = differs || ( *halfVerts )[i] != verts[i];
+    }
+    TESTING_ASSERT( differs );
+}
+
+//-*****************************************************************************
+void checkSameMeshSample( const IPolyMeshSchema::Sample &iA,
+                          const IPolyMeshSchema::Sample &iB )
+{
+    TESTING_ASSERT( iA.getPositions()->getKey() ==
+                    iB.getPositions()->getKey() );
+    TESTING_ASSERT( iA.getFaceIndices()->getKey() ==
+                    iB.getFaceIndices()->getKey() );
+    TESTING_ASSERT( iA.getFaceCounts()->getKey() ==
+                    iB.getFaceCounts()->getKey() );
+    TESTING_ASSERT( iA.getSelfBounds() == iB.getSelfBounds() );
+    TESTING_ASSERT( ( iA.getVelocities() && iB.getVelocities() &&
+                      iA.getVelocities()->getKey() ==
+                      iB.getVelocities()->getKey() ) ||
+                    ( !iA.getVelocities() && !iB.getVelocities() ) );
+}
+
+//-*****************************************************************************
+// gets a sample of a mesh using the pool it is being run on
+class GetMeshTask : public Alembic::Util::Task
+{
+public:
+    GetMeshTask( IPolyMeshSchema &iMesh, index_t iIndex,
+                 Alembic::Util::ThreadPool &iPool,
+                 IPolyMeshSchema::Sample &oSamp )
+        : m_mesh( iMesh ), m_index( iIndex ), m_pool( iPool ),
+          m_samp( oSamp ) {}
+
+    virtual void run()
+    {
+        m_mesh.get( m_samp, ISampleSelector( m_index ), m_pool );
+    }
+
+private:
+    IPolyMeshSchema &m_mesh;
+    index_t m_index;
+    Alembic::Util::ThreadPool &m_pool;
+    IPolyMeshSchema::Sample &m_samp;
+};
+
+//-*****************************************************************************
+void concurrentGetTest()
+{
+    std::string name = "meshConcurrentGet.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        OPolyMesh meshyObj( OObject( archive, kTop ), "mesh" );
+        OPolyMeshSchema &mesh = meshyObj.getSchema();
+
+        std::vector< V3f > verts( g_numVerts );
+        for ( size_t i = 0; i < g_numVerts; ++i )
+        {
+            verts[i] = V3f( g_verts[3*i], g_verts[3*i+1], g_verts[3*i+2] );
+        }
+
+        OPolyMeshSchema::Sample mesh_samp(
+            V3fArraySample( verts ),
+            Int32ArraySample( g_indices, g_numIndices ),
+            Int32ArraySample( g_counts, g_numCounts ) );
+        mesh_samp.setVelocities( V3fArraySample( ( const V3f * )g_veloc,
+                                                 g_numVerts ) );
+
+        for ( size_t i = 0; i < 4; ++i )
+        {
+            mesh.set( mesh_samp );
+            for ( size_t j = 0; j < g_numVerts; ++j )
+            {
+                verts[j] *= 2;
+            }
+        }
+    }
+
+    Alembic::Util::ThreadPool pool( 4 );
+
+    // two streams, so the reads have to share them
+    Alembic::AbcCoreOgawa::ReadArchive reader( 2 );
+    IArchive archive( reader, name );
+    TESTING_ASSERT( archive.getPtr()->supportsConcurrentReads() );
+
+    IPolyMesh meshyObj( IObject( archive, kTop ), "mesh" );
+    IPolyMeshSchema &mesh = meshyObj.getSchema();
+    TESTING_ASSERT( 4 == mesh.getNumSamples() );
+
+    for ( index_t i = 0; i < 4; ++i )
+    {
+        IPolyMeshSchema::Sample concurrentSamp;
+        mesh.get( concurrentSamp, ISampleSelector( i ), pool );
+
+        IPolyMeshSchema::Sample samp;
+        mesh.get( samp, ISampleSelector( i ) );
+        checkSameMeshSample( concurrentSamp, samp );
+        TESTING_ASSERT( concurrentSamp.getVelocities() );
+        TESTING_ASSERT( ( *concurrentSamp.getPositions() )[1] ==
+                        ( *samp.getPositions() )[1] );
+    }
+
+    // samples can be gotten from the pool's own tasks, even when every one
+    // of its threads is busy getting one
+    Alembic::Util::ThreadPool single( 1 );
+    std::vector< IPolyMeshSchema::Sample > taskSamps( 4 );
+    for ( index_t i = 0; i < 4; ++i )
+    {
+        single.add( Alembic::Util::TaskPtr(
+            new GetMeshTask( mesh, i, single, taskSamps[i] ) ) );
+    }
+    single.wait();
+
+    for ( index_t i = 0; i < 4; ++i )
+    {
+        IPolyMeshSchema::Sample samp;
+        mesh.get( samp, ISampleSelector( i ) );
+        checkSameMeshSample( taskSamps[i], samp );
+    }
+
+    // HDF5 can't be read from several threads, so this is read serially
+    IArchive hdfArchive( Alembic::AbcCoreHDF5::ReadArchive(),
+                         "polyMesh1.abc" );
+    TESTING_ASSERT( !hdfArchive.getPtr()->supportsConcurrentReads() );
+
+    IPolyMesh hdfObj( IObject( hdfArchive, kTop ), "meshy" );
+    IPolyMeshSchema::Sample concurrentSamp;
+    hdfObj.getSchema().get( concurrentSamp, ISampleSelector(), pool );
+
+    IPolyMeshSchema::Sample samp;
+    hdfObj.getSchema().get( samp );
+    checkSameMeshSample( concurrentSamp, samp );
+}
+
+//-*****************************************************************************
+void topologyChangedTest( bool iOgawa )
+{
+    std::string name = "meshTopologyChanged.abc";
+    {
+        OArchive archive;
+        if ( iOgawa )
+        {
+            archive = OArchive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        }
+        else
+        {
+            archive = OArchive( Alembic::AbcCoreHDF5::WriteArchive(), name );
+        }
+
+        OPolyMesh meshyObj( OObject( archive, kTop ), "mesh" );
+        OPolyMeshSchema &mesh = meshyObj.getSchema();
+
+        std::vector< V3f > verts( g_numVerts );
+        for ( size_t i = 0; i < g_numVerts; ++i )
+        {
+            verts[i] = V3f( g_verts[3*i], g_verts[3*i+1], g_verts[3*i+2] );
+        }
+
+        // the same faces wound the other way around
+        std::vector< int32_t > flipped( g_indices, g_indices + g_numIndices );
+        std::reverse( flipped.begin(), flipped.end() );
+
+        // 0 and 1 share their topology, as do 2 and 3
+        for ( size_t i = 0; i < 4; ++i )
+        {
+            OPolyMeshSchema::Sample mesh_samp(
+                V3fArraySample( verts ),
+                i < 2 ? Int32ArraySample( g_indices, g_numIndices ) :
+                        Int32ArraySample( flipped ),
+                Int32ArraySample( g_counts, g_numCounts ) );
+            mesh.set( mesh_samp );
+
+            for ( size_t j = 0; j < g_numVerts; ++j )
+            {
+                verts[j] *= 2;
+            }
+        }
+    }
+
+    IArchive archive;
+    if ( iOgawa )
+    {
+        archive = IArchive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+    }
+    else
+    {
+        archive = IArchive( Alembic::AbcCoreHDF5::ReadArchive(), name );
+    }
+
+    IPolyMesh meshyObj( IObject( archive, kTop ), "mesh" );
+    IPolyMeshSchema &mesh = meshyObj.getSchema();
+    TESTING_ASSERT( mesh.getTopologyVariance() == kHeterogenousTopology );
+
+    std::vector< ISampleSelector > ss;
+    for ( index_t i = 0; i < 4; ++i )
+    {
+        ss.push_back( ISampleSelector( i ) );
+    }
+
+    TESTING_ASSERT( !mesh.isTopologyChanged( ss[0], ss[0] ) );
+    TESTING_ASSERT( !mesh.isTopologyChanged( ss[0], ss[1] ) );
+    TESTING_ASSERT( mesh.isTopologyChanged( ss[1], ss[2] ) );
+    TESTING_ASSERT( !mesh.isTopologyChanged( ss[2], ss[3] ) );
+    TESTING_ASSERT( mesh.isTopologyChanged( ss[3], ss[0] ) );
+
+    IPolyMeshSchema::Sample samp;
+    mesh.get( samp, ss[0] );
+    Int32ArraySamplePtr indices = samp.getFaceIndices();
+    Int32ArraySamplePtr counts = samp.getFaceCounts();
+
+    mesh.getDeformed( samp, ss[1] );
+    TESTING_ASSERT( samp.getFaceIndices() == indices );
+    TESTING_ASSERT( samp.getFaceCounts() == counts );
+
+    IPolyMeshSchema::Sample fullSamp;
+    mesh.get( fullSamp, ss[1] );
+    TESTING_ASSERT( samp.getPositions()->getKey() ==
+                    fullSamp.getPositions()->getKey() );
+    TESTING_ASSERT( samp.getSelfBounds() == fullSamp.getSelfBounds() );
+    TESTING_ASSERT( ( *samp.getPositions() )[1] == V3f(
+        g_verts[3], g_verts[4], g_verts[5] ) * 2.0f );
+}
+
 //-*****************************************************************************
 //-*****************************************************************************
 //-*****************************************************************************
@@ -360,5 +791,14 @@ int main( int argc, char *argv[] )
     meshUnderXformOut( "animatedXformedMesh.abc" );
 
     optPropTest();
+
+    precisionTest();
+
+    precisionCacheTest();
+
+    concurrentGetTest();
+
+    topologyChangedTest( true );
+    topologyChangedTest( false );
     return 0;
 }
@@ -378,6 +378,36 @@ void optPropTest()
     }
 }
 
+//-*****************************************************************************
+void topologyChangedTest()
+{
+    IArchive archive( Alembic::AbcCoreHDF5::ReadArchive(), "subD1.abc" );
+
+    ISubD meshyObj( IObject( archive, kTop ), "subd" );
+    ISubDSchema &mesh = meshyObj.getSchema();
+    TESTING_ASSERT( 3 == mesh.getNumSamples() );
+
+    std::vector< ISampleSelector > ss;
+    for ( index_t i = 0; i < 3; ++i )
+    {
+        ss.push_back( ISampleSelector( i ) );
+    }
+
+    // only the interpolate boundary changes, from 0 to 1 and back again
+    TESTING_ASSERT( mesh.isTopologyChanged( ss[0], ss[1] ) );
+    TESTING_ASSERT( mesh.isTopologyChanged( ss[1], ss[2] ) );
+    TESTING_ASSERT( !mesh.isTopologyChanged( ss[0], ss[2] ) );
+
+    ISubDSchema::Sample samp;
+    mesh.get( samp, ss[0] );
+    Int32ArraySamplePtr creases = samp.getCreaseIndices();
+
+    mesh.getDeformed( samp, ss[2] );
+    TESTING_ASSERT( samp.getCreaseIndices() == creases );
+    TESTING_ASSERT( samp.getPositions()->size() == g_numVerts );
+    TESTING_ASSERT( samp.getVelocities()->size() == g_numVerts );
+}
+
 //-*****************************************************************************
 int main( int argc, char *argv[] )
 {
@@ -385,5 +415,7 @@ int main( int argc, char *argv[] )
     Example1_MeshIn();
 
     optPropTest();
+
+    topologyChangedTest();
     return 0;
 }
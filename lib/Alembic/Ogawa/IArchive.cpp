@@ -39,14 +39,16 @@ namespace Alembic {
 namespace Ogawa {
 namespace ALEMBIC_VERSION_NS {
 
-IArchive::IArchive(const std::string & iFileName, std::size_t iNumStreams) :
-    mStreams(new IStreams(iFileName, iNumStreams))
+IArchive::IArchive(const std::string & iFileName, std::size_t iNumStreams,
+                   bool iUseMMap, IStreamsObserverPtr iObserver) :
+    mStreams(new IStreams(iFileName, iNumStreams, iUseMMap, iObserver))
 {
     init();
 }
 
-IArchive::IArchive(const std::vector< std::istream * > & iStreams) :
-    mStreams(new IStreams(iStreams))
+IArchive::IArchive(const std::vector< std::istream * > & iStreams,
+                   IStreamsObserverPtr iObserver) :
+    mStreams(new IStreams(iStreams, iObserver))
 {
     init();
 }
@@ -75,6 +77,11 @@ bool IArchive::isFrozen() const
     return mStreams->isFrozen();
 }
 
+bool IArchive::isMemoryMapped() const
+{
+    return mStreams->isMemoryMapped();
+}
+
 Alembic::Util::uint16_t IArchive::getVersion() const
 {
     return mStreams->getVersion();
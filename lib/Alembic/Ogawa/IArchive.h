@@ -49,14 +49,21 @@ namespace ALEMBIC_VERSION_NS {
 class IArchive
 {
 public:
-    IArchive(const std::string & iFileName, std::size_t iNumStreams=1);
-    IArchive(const std::vector< std::istream * > & iStreams);
+    // iUseMMap memory maps the file instead of opening iNumStreams streams
+    // iObserver, if given, is told about everything read from the file
+    IArchive(const std::string & iFileName, std::size_t iNumStreams=1,
+             bool iUseMMap=false,
+             IStreamsObserverPtr iObserver=IStreamsObserverPtr());
+    IArchive(const std::vector< std::istream * > & iStreams,
+             IStreamsObserverPtr iObserver=IStreamsObserverPtr());
     ~IArchive();
 
     bool isValid() const;
 
     bool isFrozen() const;
 
+    bool isMemoryMapped() const;
+
     Alembic::Util::uint16_t getVersion() const;
 
     IGroupPtr getGroup() const;
@@ -38,6 +38,8 @@
 #include <Alembic/Ogawa/IData.h>
 #include <Alembic/Ogawa/IStreams.h>
 
+#include <algorithm>
+
 namespace Alembic {
 namespace Ogawa {
 namespace ALEMBIC_VERSION_NS {
@@ -81,6 +83,11 @@ IData::IData(IStreamsPtr iStreams,
     {
         mData->streams->read(iThreadId, mData->pos, 8, &size);
         mData->size = size;
+
+        if (mData->streams->getObserver())
+        {
+            mData->streams->getObserver()->data(mData->pos, size);
+        }
     }
 }
 
@@ -97,6 +104,19 @@ void IData::read(Alembic::Util::uint64_t iSize, void * iData,
     mData->streams->read(iThreadId, mData->pos + iOffset + 8, iSize, iData);
 }
 
+const void * IData::getMappedData(Alembic::Util::uint64_t iSize,
+                                  Alembic::Util::uint64_t iOffset) const
+{
+    // same restrictions as read
+    if (iSize == 0 || mData->size == 0 || iOffset + iSize > mData->size)
+    {
+        return NULL;
+    }
+
+    // +8 is to account for the size
+    return mData->streams->getMappedData(mData->pos + iOffset + 8, iSize);
+}
+
 Alembic::Util::uint64_t IData::getSize() const
 {
     return mData->size;
@@ -107,6 +127,109 @@ Alembic::Util::uint64_t IData::getPos() const
     return mData->pos;
 }
 
+namespace {
+
+// data which are within this many bytes of each other are read together,
+// reading a few unwanted bytes is cheaper than another lock and seek
+const Alembic::Util::uint64_t MAX_READ_GAP = 4096;
+
+// but don't let one read grow too large
+const Alembic::Util::uint64_t MAX_READ_SIZE = 16777216;
+
+struct ReadRequest
+{
+    Alembic::Util::uint64_t pos;
+    Alembic::Util::uint64_t size;
+    void * buf;
+
+    bool operator<(const ReadRequest & iRhs) const
+    {
+        return pos < iRhs.pos;
+    }
+};
+
+} // End anonymous namespace
+
+void IData::readMany(const std::vector< IDataPtr > & iData,
+                     Alembic::Util::uint64_t iOffset,
+                     const std::vector< void * > & oBufs,
+                     std::size_t iThreadId)
+{
+    IStreamsPtr streams;
+    std::vector< ReadRequest > requests;
+    requests.reserve(iData.size());
+    for (std::size_t i = 0; i < iData.size() && i < oBufs.size(); ++i)
+    {
+        if (!iData[i] || iData[i]->mData->size <= iOffset)
+        {
+            continue;
+        }
+
+        ReadRequest request;
+
+        // +8 is to account for the size
+        request.pos = iData[i]->mData->pos + iOffset + 8;
+        request.size = iData[i]->mData->size - iOffset;
+        request.buf = oBufs[i];
+        requests.push_back(request);
+        streams = iData[i]->mData->streams;
+    }
+
+    if (requests.empty())
+    {
+        return;
+    }
+
+    // nothing to gain from merging, copying from the map is cheap
+    if (streams->isMemoryMapped())
+    {
+        for (std::size_t i = 0; i < requests.size(); ++i)
+        {
+            streams->read(iThreadId, requests[i].pos, requests[i].size,
+                          requests[i].buf);
+        }
+        return;
+    }
+
+    std::sort(requests.begin(), requests.end());
+
+    std::vector< char > buf;
+    std::size_t start = 0;
+    while (start < requests.size())
+    {
+        // find the run of requests that we can read together
+        Alembic::Util::uint64_t runStart = requests[start].pos;
+        Alembic::Util::uint64_t runEnd = runStart + requests[start].size;
+        std::size_t end = start + 1;
+        while (end < requests.size() &&
+               requests[end].pos <= runEnd + MAX_READ_GAP &&
+               std::max(runEnd, requests[end].pos + requests[end].size) -
+                   runStart <= MAX_READ_SIZE)
+        {
+            runEnd = std::max(runEnd, requests[end].pos + requests[end].size);
+            ++end;
+        }
+
+        if (end == start + 1)
+        {
+            streams->read(iThreadId, runStart, requests[start].size,
+                          requests[start].buf);
+        }
+        else
+        {
+            buf.resize(runEnd - runStart);
+            streams->read(iThreadId, runStart, runEnd - runStart, &buf[0]);
+            for (std::size_t i = start; i < end; ++i)
+            {
+                memcpy(requests[i].buf, &buf[requests[i].pos - runStart],
+                       requests[i].size);
+            }
+        }
+
+        start = end;
+    }
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace Ogawa
 } // End namespace Alembic
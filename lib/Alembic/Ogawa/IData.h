@@ -43,6 +43,9 @@ namespace Alembic {
 namespace Ogawa {
 namespace ALEMBIC_VERSION_NS {
 
+class IData;
+typedef Alembic::Util::shared_ptr< IData > IDataPtr;
+
 class IData
 {
 public:
@@ -54,10 +57,26 @@ public:
 
     Alembic::Util::uint64_t getSize() const;
 
+    // if the archive is memory mapped, returns a pointer to iSize bytes
+    // starting at iOffset within our data, otherwise returns NULL.
+    // The pointer is only valid as long as this IData is alive.
+    const void * getMappedData(Alembic::Util::uint64_t iSize,
+                               Alembic::Util::uint64_t iOffset) const;
+
     // not really necessary for most workflows, it could be used by some
     // Ogawa utilities to detect when this IData is shared
     Alembic::Util::uint64_t getPos() const;
 
+    // reads everything after the first iOffset bytes of each of iData into
+    // the matching oBufs.  Data which are close together in the file are
+    // read from the stream with one read, instead of one read each.
+    // All of iData must come from the same archive, NULL data and data
+    // which are no bigger than iOffset are skipped.
+    static void readMany(const std::vector< IDataPtr > & iData,
+                         Alembic::Util::uint64_t iOffset,
+                         const std::vector< void * > & oBufs,
+                         std::size_t iThreadId);
+
 private:
     friend class IGroup;
     IData(IStreamsPtr iStreams, Alembic::Util::uint64_t iPos,
@@ -67,8 +86,6 @@ private:
     std::auto_ptr< PrivateData > mData;
 };
 
-typedef Alembic::Util::shared_ptr< IData > IDataPtr;
-
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
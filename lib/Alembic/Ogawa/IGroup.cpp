@@ -76,6 +76,11 @@ IGroup::IGroup(IStreamsPtr iStreams,
     mData->pos = iPos;
     mData->streams->read(iThreadIndex, iPos, 8, &mData->numChildren);
 
+    if (mData->streams->getObserver())
+    {
+        mData->streams->getObserver()->group(iPos, mData->numChildren);
+    }
+
     // 0 should NOT have been written, this groups should have been the
     // special EMPTY_GROUP instead
 
@@ -34,19 +34,159 @@
 //-*****************************************************************************
 
 #include <Alembic/Ogawa/IStreams.h>
+#include <cstring>
 #include <fstream>
+#include <limits>
 #include <stdexcept>
 
+#ifndef _MSC_VER
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 namespace Alembic {
 namespace Ogawa {
 namespace ALEMBIC_VERSION_NS {
 
+namespace {
+
+// read-only mapping of an entire file, if anything goes wrong data() is NULL
+class MappedFile : Alembic::Util::noncopyable
+{
+public:
+    MappedFile(const std::string & iFileName);
+    ~MappedFile();
+
+    const char * data() const { return m_data; }
+    Alembic::Util::uint64_t size() const { return m_size; }
+
+private:
+    const char * m_data;
+    Alembic::Util::uint64_t m_size;
+
+#ifdef _MSC_VER
+    HANDLE m_file;
+    HANDLE m_mapping;
+#endif
+};
+
+#ifdef _MSC_VER
+
+MappedFile::MappedFile(const std::string & iFileName) :
+    m_data(NULL), m_size(0), m_file(INVALID_HANDLE_VALUE), m_mapping(NULL)
+{
+    m_file = CreateFileA(iFileName.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                         NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (m_file == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(m_file, &fileSize) || fileSize.QuadPart == 0 ||
+        (Alembic::Util::uint64_t)(fileSize.QuadPart) >
+        (Alembic::Util::uint64_t)(std::numeric_limits<SIZE_T>::max()))
+    {
+        return;
+    }
+
+    m_mapping = CreateFileMapping(m_file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (m_mapping == NULL)
+    {
+        return;
+    }
+
+    m_data = (const char *) MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+    if (m_data)
+    {
+        m_size = fileSize.QuadPart;
+    }
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_data)
+    {
+        UnmapViewOfFile(m_data);
+    }
+
+    if (m_mapping)
+    {
+        CloseHandle(m_mapping);
+    }
+
+    if (m_file != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(m_file);
+    }
+}
+
+#else
+
+MappedFile::MappedFile(const std::string & iFileName) :
+    m_data(NULL), m_size(0)
+{
+    int fd = open(iFileName.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return;
+    }
+
+    struct stat buf;
+    if (fstat(fd, &buf) == 0 && buf.st_size > 0 &&
+        (Alembic::Util::uint64_t)(buf.st_size) <=
+        (Alembic::Util::uint64_t)(std::numeric_limits<std::size_t>::max()))
+    {
+        void * mapped = mmap(NULL, buf.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (mapped != MAP_FAILED)
+        {
+            m_data = (const char *) mapped;
+            m_size = buf.st_size;
+        }
+    }
+
+    // the mapping stays valid after the descriptor is closed
+    close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_data)
+    {
+        munmap((void *) m_data, m_size);
+    }
+}
+
+#endif
+
+// seconds since some fixed point, only used for differences
+double getTime()
+{
+#ifdef _MSC_VER
+    LARGE_INTEGER freq;
+    LARGE_INTEGER count;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&count);
+    return (double) count.QuadPart / (double) freq.QuadPart;
+#else
+    timeval t;
+    gettimeofday(&t, 0);
+    return (double) t.tv_sec + (double) t.tv_usec / 1000000.0;
+#endif
+}
+
+} // End anonymous namespace
+
 class IStreams::PrivateData
 {
 public:
     PrivateData()
     {
         locks = NULL;
+        mapped = NULL;
         valid = false;
         frozen = false;
         version = 0;
@@ -59,6 +199,11 @@ public:
             delete [] locks;
         }
 
+        if (mapped)
+        {
+            delete mapped;
+        }
+
         // only cleanup if we were the ones who opened it
         if (!fileName.empty())
         {
@@ -77,17 +222,44 @@ public:
 
     std::vector<std::istream *> streams;
     std::vector<Alembic::Util::uint64_t> offsets;
+
+    // where the last read of each stream ended, only kept with an observer
+    std::vector<Alembic::Util::uint64_t> nextPos;
+    IStreamsObserverPtr observer;
+
     Alembic::Util::mutex * locks;
+    MappedFile * mapped;
     std::string fileName;
     bool valid;
     bool frozen;
     Alembic::Util::uint16_t version;
 };
 
-IStreams::IStreams(const std::string & iFileName, std::size_t iNumStreams) :
+IStreams::IStreams(const std::string & iFileName, std::size_t iNumStreams,
+                   bool iUseMMap, IStreamsObserverPtr iObserver) :
     mData(new IStreams::PrivateData())
 {
 
+    if (iUseMMap)
+    {
+        mData->mapped = new MappedFile(iFileName);
+        if (mData->mapped->data() != NULL)
+        {
+            mData->fileName = iFileName;
+            init();
+            if (!mData->valid || mData->version != 1)
+            {
+                mData->valid = false;
+            }
+            mData->observer = iObserver;
+            return;
+        }
+
+        // couldn't map it, so try the regular file streams instead
+        delete mData->mapped;
+        mData->mapped = NULL;
+    }
+
     std::ifstream * filestream = new std::ifstream;
     filestream->open(iFileName.c_str(), std::ios::binary);
 
@@ -121,9 +293,12 @@ IStreams::IStreams(const std::string & iFileName, std::size_t iNumStreams) :
         }
     }
     mData->locks = new Alembic::Util::mutex[mData->streams.size()];
+    mData->nextPos.resize(mData->streams.size(), 16);
+    mData->observer = iObserver;
 }
 
-IStreams::IStreams(const std::vector< std::istream * > & iStreams) :
+IStreams::IStreams(const std::vector< std::istream * > & iStreams,
+                   IStreamsObserverPtr iObserver) :
     mData(new IStreams::PrivateData())
 {
     mData->streams = iStreams;
@@ -135,6 +310,8 @@ IStreams::IStreams(const std::vector< std::istream * > & iStreams) :
     }
 
     mData->locks = new Alembic::Util::mutex[mData->streams.size()];
+    mData->nextPos.resize(mData->streams.size(), 16);
+    mData->observer = iObserver;
 }
 
 void IStreams::init()
@@ -153,18 +330,36 @@ void IStreams::init()
             "Ogawa currently only supports little-endian reading.");
     }
 
-    if (mData->streams.empty())
+    std::size_t numHeaders = mData->streams.size();
+    if (mData->mapped)
+    {
+        // a mapping starts at the beginning of the file, and has no streams
+        numHeaders = 1;
+        mData->offsets.push_back(0);
+    }
+
+    if (numHeaders == 0)
     {
         return;
     }
 
     Alembic::Util::uint64_t firstGroupPos = 0;
 
-    for (std::size_t i = 0; i < mData->streams.size(); ++i)
+    for (std::size_t i = 0; i < numHeaders; ++i)
     {
         char header[16] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
-        mData->offsets.push_back(mData->streams[i]->tellg());
-        mData->streams[i]->read(header, 16);
+        if (mData->mapped)
+        {
+            if (mData->mapped->size() >= 16)
+            {
+                memcpy(header, mData->mapped->data(), 16);
+            }
+        }
+        else
+        {
+            mData->offsets.push_back(mData->streams[i]->tellg());
+            mData->streams[i]->read(header, 16);
+        }
         std::string magicStr(header, 5);
         if (magicStr != "Ogawa")
         {
@@ -211,6 +406,11 @@ bool IStreams::isFrozen()
     return mData->frozen;
 }
 
+bool IStreams::isMemoryMapped()
+{
+    return mData->mapped != NULL;
+}
+
 Alembic::Util::uint16_t IStreams::getVersion()
 {
     return mData->version;
@@ -224,17 +424,72 @@ void IStreams::read(std::size_t iThreadId, Alembic::Util::uint64_t iPos,
         return;
     }
 
+    if (mData->mapped)
+    {
+        // don't read anything beyond the end of the mapping
+        if (iPos < mData->mapped->size() &&
+            iSize <= mData->mapped->size() - iPos)
+        {
+            memcpy(oBuf, mData->mapped->data() + iPos, iSize);
+            if (mData->observer)
+            {
+                mData->observer->read(iThreadId, iPos, iSize, 0.0, false);
+            }
+        }
+        return;
+    }
+
     std::size_t threadId = 0;
     if (iThreadId < mData->streams.size())
     {
         threadId = iThreadId;
     }
 
+    if (!mData->observer)
     {
         Alembic::Util::scoped_lock l(mData->locks[threadId]);
         mData->streams[threadId]->seekg(iPos + mData->offsets[threadId]);
         mData->streams[threadId]->read((char *)oBuf, iSize);
+        return;
     }
+
+    double lockWait = 0.0;
+    bool seeked = false;
+    {
+        double start = getTime();
+        Alembic::Util::scoped_lock l(mData->locks[threadId]);
+        lockWait = getTime() - start;
+
+        seeked = (mData->nextPos[threadId] != iPos);
+        mData->nextPos[threadId] = iPos + iSize;
+
+        mData->streams[threadId]->seekg(iPos + mData->offsets[threadId]);
+        mData->streams[threadId]->read((char *)oBuf, iSize);
+    }
+
+    mData->observer->read(threadId, iPos, iSize, lockWait, seeked);
+}
+
+const void * IStreams::getMappedData(Alembic::Util::uint64_t iPos,
+                                     Alembic::Util::uint64_t iSize)
+{
+    if (!isValid() || !mData->mapped || iPos >= mData->mapped->size() ||
+        iSize > mData->mapped->size() - iPos)
+    {
+        return NULL;
+    }
+
+    if (mData->observer)
+    {
+        mData->observer->read(0, iPos, iSize, 0.0, false);
+    }
+
+    return mData->mapped->data() + iPos;
+}
+
+IStreamsObserver * IStreams::getObserver()
+{
+    return mData->observer.get();
 }
 
 } // End namespace ALEMBIC_VERSION_NS
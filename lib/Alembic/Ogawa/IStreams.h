@@ -44,21 +44,61 @@ namespace Alembic {
 namespace Ogawa {
 namespace ALEMBIC_VERSION_NS {
 
+// told about every read made through IStreams, and every group and data
+// made from them, after the file header has been read.  The calls come from
+// whichever thread is reading, so it has to be thread safe.
+class IStreamsObserver
+{
+public:
+    virtual ~IStreamsObserver() {}
+
+    // iSize bytes at iPos were read with iThreadId, iLockWait is how many
+    // seconds were spent waiting for its stream, and iSeeked is whether the
+    // stream had to move from where its last read ended.
+    virtual void read(std::size_t iThreadId, Alembic::Util::uint64_t iPos,
+                      Alembic::Util::uint64_t iSize, double iLockWait,
+                      bool iSeeked) = 0;
+
+    virtual void group(Alembic::Util::uint64_t iPos,
+                       Alembic::Util::uint64_t iNumChildren) = 0;
+
+    virtual void data(Alembic::Util::uint64_t iPos,
+                      Alembic::Util::uint64_t iSize) = 0;
+};
+typedef Alembic::Util::shared_ptr< IStreamsObserver > IStreamsObserverPtr;
+
 class IStreams
 {
 public:
-    IStreams(const std::string & iFileName, std::size_t iNumStreams=1);
-    IStreams(const std::vector< std::istream * > & iStreams);
+    // if iUseMMap is true the file is memory mapped read-only and
+    // iNumStreams is ignored, since reads no longer need a stream or a lock.
+    // If the file can not be mapped we fall back to iNumStreams file streams
+    IStreams(const std::string & iFileName, std::size_t iNumStreams=1,
+             bool iUseMMap=false,
+             IStreamsObserverPtr iObserver=IStreamsObserverPtr());
+    IStreams(const std::vector< std::istream * > & iStreams,
+             IStreamsObserverPtr iObserver=IStreamsObserverPtr());
     ~IStreams();
 
     bool isValid();
     bool isFrozen();
+    bool isMemoryMapped();
     Alembic::Util::uint16_t getVersion();
 
     // locks on the threadId, seeks to iPos, and reads iSize bytes into oBuf
+    // when memory mapped the threadId is ignored and the data is copied
+    // straight out of the mapping without locking
     void read(std::size_t iThreadId, Alembic::Util::uint64_t iPos,
               Alembic::Util::uint64_t iSize, void * oBuf);
 
+    // when memory mapped returns a pointer to the iSize bytes at iPos within
+    // the mapping, otherwise (or if it would go beyond the end) returns NULL
+    const void * getMappedData(Alembic::Util::uint64_t iPos,
+                               Alembic::Util::uint64_t iSize);
+
+    // may be NULL
+    IStreamsObserver * getObserver();
+
 private:
     // noncopyable
     IStreams(const IStreams &);
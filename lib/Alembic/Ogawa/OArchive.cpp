@@ -41,14 +41,17 @@ namespace Alembic {
 namespace Ogawa {
 namespace ALEMBIC_VERSION_NS {
 
-OArchive::OArchive(const std::string & iFileName) :
-    mStream(new OStream(iFileName))
+OArchive::OArchive(const std::string & iFileName, std::size_t iBufferSize,
+                   bool iWriteInBackground) :
+    mStream(new OStream(iFileName, iBufferSize, iWriteInBackground))
 {
     mGroup.reset(new OGroup(mStream));
 }
 
-OArchive::OArchive(std::ostream * iStream) :
-    mStream(new OStream(iStream)), mGroup(new OGroup(mStream))
+OArchive::OArchive(std::ostream * iStream, std::size_t iBufferSize,
+                   bool iWriteInBackground) :
+    mStream(new OStream(iStream, iBufferSize, iWriteInBackground)),
+    mGroup(new OGroup(mStream))
 {
 }
 
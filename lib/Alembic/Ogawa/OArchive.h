@@ -47,8 +47,13 @@ namespace ALEMBIC_VERSION_NS {
 class OArchive
 {
 public:
-    OArchive(const std::string & iFileName);
-    OArchive(std::ostream * iStream);
+    // see OStream for iBufferSize and iWriteInBackground
+    OArchive(const std::string & iFileName,
+             std::size_t iBufferSize = OStream::DEFAULT_BUFFER_SIZE,
+             bool iWriteInBackground = false);
+    OArchive(std::ostream * iStream,
+             std::size_t iBufferSize = OStream::DEFAULT_BUFFER_SIZE,
+             bool iWriteInBackground = false);
     ~OArchive();
 
     OGroupPtr getGroup();
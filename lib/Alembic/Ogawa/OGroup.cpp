@@ -110,11 +110,9 @@ ODataPtr OGroup::createData(Alembic::Util::uint64_t iSize, const void * iData)
         return child;
     }
 
-    Alembic::Util::uint64_t pos = mData->stream->getAndSeekEndPos();
-
-    Alembic::Util::uint64_t size = iSize;
-    mData->stream->write(&size, 8);
-    mData->stream->write(iData, iSize);
+    // appended in one go since other threads may be writing other groups
+    Alembic::Util::uint64_t pos = mData->stream->append(iSize, 1, &iData,
+                                                        &iSize);
 
     child.reset(new OData(mData->stream, pos, iSize));
 
@@ -156,17 +154,8 @@ ODataPtr OGroup::createData(Alembic::Util::uint64_t iNumData,
         return child;
     }
 
-    Alembic::Util::uint64_t pos = mData->stream->getAndSeekEndPos();
-
-    mData->stream->write(&totalSize, 8);
-    for (Alembic::Util::uint64_t i = 0; i < iNumData; ++i)
-    {
-        Alembic::Util::uint64_t size = iSizes[i];
-        if (size != 0)
-        {
-            mData->stream->write(iDatas[i], size);
-        }
-    }
+    Alembic::Util::uint64_t pos = mData->stream->append(totalSize,
+        (std::size_t)iNumData, iDatas, iSizes);
 
     child.reset(new OData(mData->stream, pos, totalSize));
 
@@ -245,10 +234,10 @@ void OGroup::freeze()
     }
     else
     {
-        mData->pos = mData->stream->getAndSeekEndPos();
-        Alembic::Util::uint64_t size = mData->childVec.size();
-        mData->stream->write(&size, 8);
-        mData->stream->write(&mData->childVec.front(), size*8);
+        Alembic::Util::uint64_t size = mData->childVec.size() * 8;
+        const void * children = &mData->childVec.front();
+        mData->pos = mData->stream->append(mData->childVec.size(), 1,
+                                           &children, &size);
     }
 
     // go through and update each of the parents
@@ -258,14 +247,13 @@ void OGroup::freeze()
         // special group owned by the archive
         if (!it->first && it->second == 0)
         {
-            mData->stream->seek(8);
-            mData->stream->write(&mData->pos, 8);
+            mData->stream->writeAt(8, &mData->pos, 8);
             continue;
         }
         else if (it->first->isFrozen())
         {
-            mData->stream->seek(it->first->mData->pos + (it->second + 1) * 8);
-            mData->stream->write(&mData->pos, 8);
+            mData->stream->writeAt(
+                it->first->mData->pos + (it->second + 1) * 8, &mData->pos, 8);
         }
         it->first->mData->childVec[it->second] = mData->pos;
     }
@@ -318,8 +306,7 @@ void OGroup::replaceData(Alembic::Util::uint64_t iIndex, ODataPtr iData)
     Alembic::Util::uint64_t pos = iData->getPos() | 0x8000000000000000ULL;
     if (isFrozen())
     {
-        mData->stream->seek(mData->pos + (iIndex + 1) * 8);
-        mData->stream->write(&pos, 8);
+        mData->stream->writeAt(mData->pos + (iIndex + 1) * 8, &pos, 8);
     }
     mData->childVec[iIndex] = pos;
 }
@@ -34,18 +34,62 @@
 //-*****************************************************************************
 
 #include <Alembic/Ogawa/OStream.h>
+#include <Alembic/Util/ThreadPool.h>
 #include <fstream>
 #include <stdexcept>
+#include <vector>
+#include <algorithm>
 
 namespace Alembic {
 namespace Ogawa {
 namespace ALEMBIC_VERSION_NS {
 
+namespace {
+
+// bytes to write over something written earlier
+typedef std::pair< Alembic::Util::uint64_t, std::vector< char > > Patch;
+
+class WriteTask : public Alembic::Util::Task
+{
+public:
+    WriteTask(std::ostream * iStream, Alembic::Util::uint64_t iPos,
+              const std::vector< char > & iBuffer,
+              const std::vector< Patch > & iPatches) :
+        mStream(iStream), mPos(iPos), mBuffer(iBuffer), mPatches(iPatches)
+    {
+    }
+
+    virtual void run()
+    {
+        if (!mBuffer.empty())
+        {
+            mStream->seekp(mPos);
+            mStream->write(&mBuffer.front(), mBuffer.size());
+        }
+
+        for (std::size_t i = 0; i < mPatches.size(); ++i)
+        {
+            mStream->seekp(mPatches[i].first);
+            mStream->write(&mPatches[i].second.front(),
+                           mPatches[i].second.size());
+        }
+    }
+
+private:
+    std::ostream * mStream;
+    Alembic::Util::uint64_t mPos;
+    const std::vector< char > & mBuffer;
+    const std::vector< Patch > & mPatches;
+};
+
+} // End anonymous namespace
+
 class OStream::PrivateData
 {
 public:
-    PrivateData(const std::string & iFileName) :
-        stream(NULL), fileName(iFileName), startPos(0)
+    PrivateData(const std::string & iFileName, std::size_t iBufferSize) :
+        stream(NULL), fileName(iFileName), startPos(0), bufferSize(iBufferSize),
+        bufferPos(0), endPos(0), curPos(0)
     {
         std::ofstream * filestream = new std::ofstream(fileName.c_str(),
             std::ios_base::trunc | std::ios_base::binary);
@@ -62,7 +106,9 @@ public:
         }
     }
 
-    PrivateData(std::ostream * iStream) : stream(iStream), startPos(0)
+    PrivateData(std::ostream * iStream, std::size_t iBufferSize) :
+        stream(iStream), startPos(0), bufferSize(iBufferSize), bufferPos(0),
+        endPos(0), curPos(0)
     {
         if (stream)
         {
@@ -95,18 +141,48 @@ public:
     std::string fileName;
     Alembic::Util::uint64_t startPos;
     Alembic::Util::mutex lock;
+
+    // the buffered bytes start at bufferPos, all positions are relative to
+    // startPos
+    std::size_t bufferSize;
+    std::vector< char > buffer;
+    Alembic::Util::uint64_t bufferPos;
+
+    // the end of everything written so far, and where the next write goes
+    Alembic::Util::uint64_t endPos;
+    Alembic::Util::uint64_t curPos;
+
+    // when writing in the background the writer thread owns writeBuffer
+    // and writePatches until it is waited on
+    Alembic::Util::auto_ptr< Alembic::Util::ThreadPool > writer;
+    std::vector< char > writeBuffer;
+    std::vector< Patch > patches;
+    std::vector< Patch > writePatches;
 };
 
-OStream::OStream(const std::string & iFileName) :
-    mData(new PrivateData(iFileName))
+OStream::OStream(const std::string & iFileName, std::size_t iBufferSize,
+                 bool iWriteInBackground) :
+    mData(new PrivateData(iFileName, iBufferSize))
 {
     init();
+
+    if (iWriteInBackground && iBufferSize > 0 && isValid())
+    {
+        mData->writer.reset(new Alembic::Util::ThreadPool(1));
+    }
 }
 
 // we'll be writing from this already open stream which we don't own
-OStream::OStream(std::ostream * iStream) : mData(new PrivateData(iStream))
+OStream::OStream(std::ostream * iStream, std::size_t iBufferSize,
+                 bool iWriteInBackground) :
+    mData(new PrivateData(iStream, iBufferSize))
 {
     init();
+
+    if (iWriteInBackground && iBufferSize > 0 && isValid())
+    {
+        mData->writer.reset(new Alembic::Util::ThreadPool(1));
+    }
 }
 
 OStream::~OStream()
@@ -114,6 +190,20 @@ OStream::~OStream()
     // write our "frozen" byte (totally done writing)
     if (isValid())
     {
+        flushBuffer();
+        if (mData->writer.get())
+        {
+            // don't throw out of the destructor, the frozen byte below just
+            // won't mean much if a write failed
+            try
+            {
+                mData->writer->wait();
+            }
+            catch (...)
+            {
+            }
+        }
+
         char frozen = 0xff;
         mData->stream->seekp(mData->startPos + 5).write(&frozen, 1).flush();
     }
@@ -148,6 +238,10 @@ void OStream::init()
             0, 1,    // 16 bit format version number
             0, 0, 0, 0, 0, 0, 0, 0}; // position of the first group
         mData->stream->write(header, sizeof(header)).flush();
+        mData->endPos = sizeof(header);
+        mData->curPos = sizeof(header);
+        mData->bufferPos = sizeof(header);
+        mData->buffer.reserve(mData->bufferSize);
     }
 }
 
@@ -156,16 +250,7 @@ Alembic::Util::uint64_t OStream::getAndSeekEndPos()
     if (isValid())
     {
         Alembic::Util::scoped_lock l(mData->lock);
-        Alembic::Util::uint64_t lastp =
-            mData->stream->seekp(0, std::ios_base::end).tellp();
-        if (lastp == INVALID_DATA || lastp < mData->startPos)
-        {
-            throw std::runtime_error(
-                "Illegal position returned Ogawa::OStream::getAndSeekEndPos");
-
-            return 0;
-        }
-        return lastp - mData->startPos;
+        return seekEndLocked();
     }
     return 0;
 }
@@ -175,7 +260,7 @@ void OStream::seek(Alembic::Util::uint64_t iPos)
     if (isValid())
     {
         Alembic::Util::scoped_lock l(mData->lock);
-        mData->stream->seekp(iPos + mData->startPos);
+        seekLocked(iPos);
     }
 }
 
@@ -184,7 +269,204 @@ void OStream::write(const void * iBuf, Alembic::Util::uint64_t iSize)
     if (isValid())
     {
         Alembic::Util::scoped_lock l(mData->lock);
+        writeLocked(iBuf, iSize);
+    }
+}
+
+Alembic::Util::uint64_t OStream::append(Alembic::Util::uint64_t iSize,
+    std::size_t iNumBufs, const void * const * iBufs,
+    const Alembic::Util::uint64_t * iBufSizes)
+{
+    if (!isValid())
+    {
+        return 0;
+    }
+
+    Alembic::Util::scoped_lock l(mData->lock);
+
+    Alembic::Util::uint64_t pos = seekEndLocked();
+    writeLocked(&iSize, 8);
+    for (std::size_t i = 0; i < iNumBufs; ++i)
+    {
+        if (iBufSizes[i] != 0)
+        {
+            writeLocked(iBufs[i], iBufSizes[i]);
+        }
+    }
+    return pos;
+}
+
+void OStream::writeAt(Alembic::Util::uint64_t iPos, const void * iBuf,
+                      Alembic::Util::uint64_t iSize)
+{
+    if (isValid())
+    {
+        Alembic::Util::scoped_lock l(mData->lock);
+        seekLocked(iPos);
+        writeLocked(iBuf, iSize);
+    }
+}
+
+Alembic::Util::uint64_t OStream::seekEndLocked()
+{
+    if (mData->bufferSize > 0)
+    {
+        mData->curPos = mData->endPos;
+        return mData->endPos;
+    }
+
+    Alembic::Util::uint64_t lastp =
+        mData->stream->seekp(0, std::ios_base::end).tellp();
+    if (lastp == INVALID_DATA || lastp < mData->startPos)
+    {
+        throw std::runtime_error(
+            "Illegal position returned Ogawa::OStream::getAndSeekEndPos");
+
+        return 0;
+    }
+    return lastp - mData->startPos;
+}
+
+void OStream::seekLocked(Alembic::Util::uint64_t iPos)
+{
+    if (mData->bufferSize > 0)
+    {
+        mData->curPos = iPos;
+        return;
+    }
+
+    mData->stream->seekp(iPos + mData->startPos);
+}
+
+void OStream::writeLocked(const void * iBuf, Alembic::Util::uint64_t iSize)
+{
+    if (mData->bufferSize == 0)
+    {
         mData->stream->write((const char *)iBuf, iSize).flush();
+        return;
+    }
+
+    const char * buf = (const char *)iBuf;
+
+    // the usual case, adding to the end
+    if (mData->curPos == mData->endPos)
+    {
+        if (mData->buffer.size() + iSize > mData->bufferSize)
+        {
+            flushBuffer();
+        }
+
+        // too big to be worth buffering, unless there is a writer thread
+        // to hand it to
+        if (iSize >= mData->bufferSize && !mData->writer.get())
+        {
+            mData->stream->seekp(mData->startPos + mData->endPos);
+            mData->stream->write(buf, iSize);
+            mData->bufferPos += iSize;
+        }
+        else
+        {
+            mData->buffer.insert(mData->buffer.end(), buf, buf + iSize);
+
+            // a big block is copied and written on its own, so the caller
+            // can go on while the writer thread writes it out
+            if (iSize >= mData->bufferSize)
+            {
+                flushBuffer();
+            }
+        }
+
+        mData->endPos += iSize;
+        mData->curPos = mData->endPos;
+        return;
+    }
+
+    // otherwise we are going back and filling in something small, like a
+    // child position, which is either already written out or still buffered
+    if (mData->curPos + iSize > mData->endPos)
+    {
+        throw std::runtime_error(
+            "Ogawa::OStream::write can not write past the end of the stream");
+    }
+
+    if (mData->curPos < mData->bufferPos)
+    {
+        Alembic::Util::uint64_t numWritten = mData->bufferPos - mData->curPos;
+        if (numWritten > iSize)
+        {
+            numWritten = iSize;
+        }
+
+        // the writer thread may not have gotten to it yet, so it is written
+        // after the next buffer
+        if (mData->writer.get())
+        {
+            mData->patches.push_back(Patch(mData->startPos + mData->curPos,
+                std::vector< char >(buf, buf + numWritten)));
+        }
+        else
+        {
+            mData->stream->seekp(mData->startPos + mData->curPos);
+            mData->stream->write(buf, numWritten);
+        }
+        buf += numWritten;
+        iSize -= numWritten;
+        mData->curPos += numWritten;
+    }
+
+    if (iSize > 0)
+    {
+        std::copy(buf, buf + iSize,
+                  mData->buffer.begin() + (mData->curPos - mData->bufferPos));
+        mData->curPos += iSize;
+    }
+}
+
+void OStream::flush()
+{
+    if (isValid())
+    {
+        Alembic::Util::scoped_lock l(mData->lock);
+        flushBuffer();
+        if (mData->writer.get())
+        {
+            mData->writer->wait();
+        }
+        mData->stream->flush();
+    }
+}
+
+// expects the lock to be held
+void OStream::flushBuffer()
+{
+    if (mData->writer.get())
+    {
+        if (mData->buffer.empty() && mData->patches.empty())
+        {
+            return;
+        }
+
+        // wait for the last buffer to be written, we reuse its memory
+        mData->writer->wait();
+
+        mData->writeBuffer.swap(mData->buffer);
+        mData->writePatches.swap(mData->patches);
+        mData->buffer.clear();
+        mData->patches.clear();
+
+        mData->writer->add(Alembic::Util::TaskPtr(new WriteTask(
+            mData->stream, mData->startPos + mData->bufferPos,
+            mData->writeBuffer, mData->writePatches)));
+
+        mData->bufferPos += mData->writeBuffer.size();
+        mData->buffer.reserve(mData->bufferSize);
+    }
+    else if (!mData->buffer.empty())
+    {
+        mData->stream->seekp(mData->startPos + mData->bufferPos);
+        mData->stream->write(&mData->buffer.front(), mData->buffer.size());
+        mData->bufferPos += mData->buffer.size();
+        mData->buffer.clear();
     }
 }
 
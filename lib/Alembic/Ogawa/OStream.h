@@ -44,11 +44,26 @@ namespace Alembic {
 namespace Ogawa {
 namespace ALEMBIC_VERSION_NS {
 
+// Writes are appended to an in memory buffer of iBufferSize bytes which is
+// written out in one go when it fills up, or when the OStream is destroyed.
+// The end position is tracked here instead of asking the stream for it.
+// A iBufferSize of 0 writes straight to the stream.
+// If iWriteInBackground is true full buffers are written by another thread
+// while the next one is filled, when that thread falls behind writes wait
+// for it so at most two buffers are held.  Writes of iBufferSize or more
+// are written straight to the stream, or when writing in the background
+// are copied and handed to the other thread as a buffer of their own.
 class OStream
 {
 public:
-    OStream(const std::string & iFileName);
-    OStream(std::ostream * iStream);
+    static const std::size_t DEFAULT_BUFFER_SIZE = 8 * 1024 * 1024;
+
+    OStream(const std::string & iFileName,
+            std::size_t iBufferSize = DEFAULT_BUFFER_SIZE,
+            bool iWriteInBackground = false);
+    OStream(std::ostream * iStream,
+            std::size_t iBufferSize = DEFAULT_BUFFER_SIZE,
+            bool iWriteInBackground = false);
     ~OStream();
 
     bool isValid();
@@ -57,6 +72,21 @@ public:
     void write(const void * iBuf, Alembic::Util::uint64_t iSize);
     void seek(Alembic::Util::uint64_t iPos);
 
+    // Writes iSize as 8 bytes followed by the iNumBufs buffers to the end
+    // of the stream and returns where iSize was written.  Unlike seeking to
+    // the end and then writing, no other thread's write can land in between.
+    Alembic::Util::uint64_t append(Alembic::Util::uint64_t iSize,
+                                   std::size_t iNumBufs,
+                                   const void * const * iBufs,
+                                   const Alembic::Util::uint64_t * iBufSizes);
+
+    // Writes over something already written at iPos, in one go like append.
+    void writeAt(Alembic::Util::uint64_t iPos, const void * iBuf,
+                 Alembic::Util::uint64_t iSize);
+
+    // writes out anything that is buffered
+    void flush();
+
 private:
     // noncopyable
     OStream(const OStream &);
@@ -66,6 +96,12 @@ private:
     Alembic::Util::auto_ptr< PrivateData > mData;
 
     void init();
+    void flushBuffer();
+
+    // these expect the lock to be held
+    Alembic::Util::uint64_t seekEndLocked();
+    void seekLocked(Alembic::Util::uint64_t iPos);
+    void writeLocked(const void * iBuf, Alembic::Util::uint64_t iSize);
 };
 
 typedef Alembic::Util::shared_ptr< OStream > OStreamPtr;
@@ -36,6 +36,7 @@
 
 #include <Alembic/Ogawa/All.h>
 #include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+#include <fstream>
 
 void test()
 {
@@ -77,9 +78,138 @@ void stringStreamTest()
     TESTING_ASSERT(ia.getGroup()->getNumChildren() == 0);
 }
 
+void memoryMappedTest()
+{
+    {
+        Alembic::Ogawa::OArchive oa("mmapTest.ogawa");
+        TESTING_ASSERT(oa.isValid());
+        char data[] = {0, 1, 2, 3, 4, 5, 6, 7};
+        oa.getGroup()->addData(8, data);
+    }
+
+    Alembic::Ogawa::IArchive ia("mmapTest.ogawa", 1, true);
+    TESTING_ASSERT(ia.isValid());
+    TESTING_ASSERT(ia.isMemoryMapped());
+    TESTING_ASSERT(ia.isFrozen());
+    TESTING_ASSERT(ia.getVersion() == 1);
+    TESTING_ASSERT(ia.getGroup()->getNumChildren() == 1);
+
+    Alembic::Ogawa::IDataPtr d = ia.getGroup()->getData(0, 0);
+    TESTING_ASSERT(d->getSize() == 8);
+    char data[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    d->read(8, data, 0, 0);
+    for (char i = 0; i < 8; ++i)
+    {
+        TESTING_ASSERT(data[i] == i);
+    }
+
+    // reading beyond the data shouldn't touch the buffer
+    data[0] = 42;
+    d->read(8, data, 1, 0);
+    TESTING_ASSERT(data[0] == 42);
+
+    // look at the data directly within the mapping
+    const char * mapped = (const char *) d->getMappedData(6, 2);
+    TESTING_ASSERT(mapped != NULL);
+    for (char i = 0; i < 6; ++i)
+    {
+        TESTING_ASSERT(mapped[i] == i + 2);
+    }
+    TESTING_ASSERT(d->getMappedData(8, 1) == NULL);
+    TESTING_ASSERT(d->getMappedData(0, 0) == NULL);
+
+    // not mapped, so no pointer
+    Alembic::Ogawa::IArchive ia2("mmapTest.ogawa", 1);
+    TESTING_ASSERT(!ia2.isMemoryMapped());
+    TESTING_ASSERT(ia2.getGroup()->getData(0, 0)->getMappedData(8, 0) == NULL);
+
+    // not an Ogawa file
+    {
+        std::ofstream bad("mmapBad.ogawa");
+        bad << "potato";
+    }
+    Alembic::Ogawa::IArchive ib("mmapBad.ogawa", 1, true);
+    TESTING_ASSERT(!ib.isValid());
+
+    // file doesn't exist, so we don't map and fall back to streams
+    Alembic::Ogawa::IArchive ic("mmapNotThere.ogawa", 1, true);
+    TESTING_ASSERT(!ic.isValid());
+    TESTING_ASSERT(!ic.isMemoryMapped());
+}
+
+void bufferedTest()
+{
+    // no buffer, a buffer smaller than some of the data, and the default,
+    // then the last two again written in the background
+    std::size_t bufferSizes[] = {0, 64,
+        Alembic::Ogawa::OStream::DEFAULT_BUFFER_SIZE, 64,
+        Alembic::Ogawa::OStream::DEFAULT_BUFFER_SIZE};
+    bool background[] = {false, false, false, true, true};
+
+    std::vector< std::string > written;
+    for (std::size_t b = 0; b < 5; ++b)
+    {
+        std::stringstream strm;
+        {
+            Alembic::Ogawa::OArchive oa(&strm, bufferSizes[b], background[b]);
+            Alembic::Ogawa::OGroupPtr child = oa.getGroup()->addGroup();
+            for (std::size_t i = 1; i < 200; i += 7)
+            {
+                std::vector< char > data(i, (char) i);
+                Alembic::Ogawa::ODataPtr d =
+                    child->addData(data.size(), &data.front());
+
+                // go back and change what was written
+                char first = 42;
+                d->rewrite(1, &first);
+            }
+
+            // written out by the time the group is frozen, and updated
+            // after that
+            Alembic::Ogawa::ODataPtr d = oa.getGroup()->addData(4, "abcd");
+            child->freeze();
+            d->rewrite(2, (void *) "xy", 1);
+        }
+        written.push_back(strm.str());
+
+        strm.seekg(0);
+        std::vector< std::istream * > streams;
+        streams.push_back(&strm);
+        Alembic::Ogawa::IArchive ia(streams);
+        TESTING_ASSERT(ia.isValid());
+        TESTING_ASSERT(ia.isFrozen());
+        TESTING_ASSERT(ia.getGroup()->getNumChildren() == 2);
+
+        Alembic::Ogawa::IGroupPtr child = ia.getGroup()->getGroup(0, false, 0);
+        TESTING_ASSERT(child->getNumChildren() == 29);
+        for (std::size_t i = 0; i < 29; ++i)
+        {
+            Alembic::Ogawa::IDataPtr d = child->getData(i, 0);
+            std::size_t size = i * 7 + 1;
+            TESTING_ASSERT(d->getSize() == size);
+            std::vector< char > data(size);
+            d->read(size, &data.front(), 0, 0);
+            TESTING_ASSERT(data[0] == 42);
+            TESTING_ASSERT(data[size - 1] == (size == 1 ? 42 : (char) size));
+        }
+
+        char abcd[4];
+        ia.getGroup()->getData(1, 0)->read(4, abcd, 0, 0);
+        TESTING_ASSERT(std::string(abcd, 4) == "axyd");
+    }
+
+    // buffering doesn't change what ends up in the file
+    TESTING_ASSERT(written[0] == written[1]);
+    TESTING_ASSERT(written[0] == written[2]);
+    TESTING_ASSERT(written[0] == written[3]);
+    TESTING_ASSERT(written[0] == written[4]);
+}
+
 int main ( int argc, char *argv[] )
 {
     test();
     stringStreamTest();
+    memoryMappedTest();
+    bufferedTest();
     return 0;
 }
\ No newline at end of file
@@ -46,5 +46,6 @@
 #include <Alembic/Util/PlainOldDataType.h>
 #include <Alembic/Util/TokenMap.h>
 #include <Alembic/Util/SpookyV2.h>
+#include <Alembic/Util/ThreadPool.h>
 
 #endif
@@ -38,6 +38,8 @@
 
 #include <Alembic/Util/Murmur3.h>
 #include <Alembic/Util/PlainOldDataType.h>
+#include <algorithm>
+#include <cstring>
 
 #ifdef __APPLE__
 #include <machine/endian.h>
@@ -49,31 +51,23 @@ namespace Alembic {
 namespace Util {
 namespace ALEMBIC_VERSION_NS {
 
-//-*****************************************************************************
-void MurmurHash3_x64_128 ( const void * key, const size_t len,
-                           const size_t podSize, void * out )
-{
-    const uint8_t * data = (const uint8_t*)key;
-    const size_t nblocks = len / 16;
-
-    uint64_t h1 = 0;
-    uint64_t h2 = 0;
-
+namespace {
 
 #ifdef _MSC_VER
-    uint64_t c1 = 0x87c37b91114253d5LL;
-    uint64_t c2 = 0x4cf5ad432745937fLL;
+const uint64_t c1 = 0x87c37b91114253d5LL;
+const uint64_t c2 = 0x4cf5ad432745937fLL;
 #else
-    uint64_t c1 = 0x87c37b91114253d5ULL;
-    uint64_t c2 = 0x4cf5ad432745937fULL;
+const uint64_t c1 = 0x87c37b91114253d5ULL;
+const uint64_t c2 = 0x4cf5ad432745937fULL;
 #endif
 
-    //----------
-    // body
-
-    const uint64_t * blocks = (const uint64_t *)(data);
+//-*****************************************************************************
+void hashBlocks( const uint8_t * iData, size_t iNumBlocks, size_t podSize,
+                 uint64_t & h1, uint64_t & h2 )
+{
+    const uint64_t * blocks = (const uint64_t *)(iData);
 
-    for(size_t i = 0; i < nblocks; i++)
+    for(size_t i = 0; i < iNumBlocks; i++)
     {
 
         uint64_t k1 = blocks[i*2];
@@ -161,35 +155,37 @@ void MurmurHash3_x64_128 ( const void * key, const size_t len,
         h2 += h1;
         h2 = h2*5+0x38495ab5;
     }
+}
 
-    //----------
-    // tail
-
+//-*****************************************************************************
+// iTailSize is less than 16, len is the size of everything that was hashed
+void hashTail( const uint8_t * iTail, size_t iTailSize, size_t podSize,
+               size_t len, uint64_t & h1, uint64_t & h2, void * out )
+{
 #if (defined(__BYTE_ORDER) && defined(__BIG_ENDIAN) && __BYTE_ORDER == __BIG_ENDIAN) || (defined(BYTE_ORDER) && defined(BIG_ENDIAN) && BYTE_ORDER == BIG_ENDIAN)
-    const uint8_t * unswappedTail = (const uint8_t*)(data + nblocks*16);
+    const uint8_t * unswappedTail = iTail;
     uint8_t tail[16];
-    size_t tailSize = len & 15;
 
     // no swapping needed
     if (podSize == 1)
     {
-        memcpy(tail, unswappedTail, tailSize);
+        memcpy(tail, unswappedTail, iTailSize);
     }
     else
     {
-        for (size_t j = 0; j < tailSize; ++j)
+        for (size_t j = 0; j < iTailSize; ++j)
         {
             tail[j] = unswappedTail[j^(podSize-1)];
         }
     }
 #else
-    const uint8_t * tail = (const uint8_t*)(data + nblocks*16);
+    const uint8_t * tail = iTail;
 #endif
 
     uint64_t k1 = 0;
     uint64_t k2 = 0;
 
-    switch(len & 15)
+    switch(iTailSize)
     {
         case 15: k2 ^= uint64_t(tail[14]) << 48;
         case 14: k2 ^= uint64_t(tail[13]) << 40;
@@ -262,6 +258,71 @@ void MurmurHash3_x64_128 ( const void * key, const size_t len,
     ((uint64_t*)out)[1] = h2;
 }
 
+} // End anonymous namespace
+
+//-*****************************************************************************
+void MurmurHash3_x64_128 ( const void * key, const size_t len,
+                           const size_t podSize, void * out )
+{
+    const uint8_t * data = (const uint8_t*)key;
+    const size_t nblocks = len / 16;
+
+    uint64_t h1 = 0;
+    uint64_t h2 = 0;
+
+    hashBlocks( data, nblocks, podSize, h1, h2 );
+    hashTail( data + nblocks*16, len & 15, podSize, len, h1, h2, out );
+}
+
+//-*****************************************************************************
+MurmurHash3Stream::MurmurHash3Stream( size_t iPodSize )
+    : m_podSize( iPodSize )
+    , m_h1( 0 )
+    , m_h2( 0 )
+    , m_len( 0 )
+    , m_tailSize( 0 )
+{
+}
+
+//-*****************************************************************************
+void MurmurHash3Stream::add( const void * iData, size_t iLen )
+{
+    const uint8_t * data = (const uint8_t*)iData;
+    m_len += iLen;
+
+    // finish off the block started by an earlier add
+    if ( m_tailSize > 0 )
+    {
+        size_t numCopied = std::min( iLen, (size_t)( 16 - m_tailSize ) );
+        memcpy( (uint8_t*)m_tail + m_tailSize, data, numCopied );
+        m_tailSize += numCopied;
+        data += numCopied;
+        iLen -= numCopied;
+
+        if ( m_tailSize < 16 )
+        {
+            return;
+        }
+
+        hashBlocks( (const uint8_t*)m_tail, 1, m_podSize, m_h1, m_h2 );
+        m_tailSize = 0;
+    }
+
+    size_t nblocks = iLen / 16;
+    hashBlocks( data, nblocks, m_podSize, m_h1, m_h2 );
+
+    m_tailSize = iLen & 15;
+    memcpy( m_tail, data + nblocks*16, m_tailSize );
+}
+
+//-*****************************************************************************
+void MurmurHash3Stream::finish( void * out )
+{
+    uint64_t h1 = m_h1;
+    uint64_t h2 = m_h2;
+    hashTail( (const uint8_t*)m_tail, m_tailSize, m_podSize, m_len, h1, h2, out );
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace Util
 } // End namespace Alembic
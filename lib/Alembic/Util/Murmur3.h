@@ -47,6 +47,30 @@ namespace ALEMBIC_VERSION_NS {
 void MurmurHash3_x64_128 ( const void * key, const size_t len,
     const size_t podSize, void * out );
 
+//-*****************************************************************************
+//! Hashes data that is handed over a piece at a time, the result is the same
+//! as MurmurHash3_x64_128 on all of the pieces put together.
+class MurmurHash3Stream
+{
+public:
+    explicit MurmurHash3Stream( size_t iPodSize );
+
+    void add( const void * iData, size_t iLen );
+
+    //! Writes the 16 byte digest to out.
+    void finish( void * out );
+
+private:
+    size_t m_podSize;
+    uint64_t m_h1;
+    uint64_t m_h2;
+    size_t m_len;
+
+    // whatever didn't fill up a whole 16 byte block
+    uint64_t m_tail[2];
+    size_t m_tailSize;
+};
+
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
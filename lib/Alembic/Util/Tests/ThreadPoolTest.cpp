@@ -0,0 +1,220 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+
+#include <Alembic/Util/ThreadPool.h>
+#include <Alembic/Util/Exception.h>
+
+#include <iostream>
+
+using namespace Alembic::Util;
+
+//-*****************************************************************************
+class CountTask : public Task
+{
+public:
+    CountTask( mutex & iLock, int & iCount, bool iThrow = false )
+        : m_lock( iLock ), m_count( iCount ), m_throw( iThrow ) {}
+
+    virtual void run()
+    {
+        if ( m_throw )
+        {
+            ALEMBIC_THROW( "Told to throw" );
+        }
+
+        scoped_lock l( m_lock );
+        ++m_count;
+    }
+
+private:
+    mutex & m_lock;
+    int & m_count;
+    bool m_throw;
+};
+
+//-*****************************************************************************
+// adds a group of CountTasks to the pool it is run on, and waits for them
+class GroupTask : public Task
+{
+public:
+    GroupTask( ThreadPool & iPool, mutex & iLock, int & iCount )
+        : m_pool( iPool ), m_lock( iLock ), m_count( iCount ) {}
+
+    virtual void run()
+    {
+        TaskGroup group( m_pool );
+        for ( int i = 0; i < 10; ++i )
+        {
+            group.add( TaskPtr( new CountTask( m_lock, m_count ) ) );
+        }
+        group.wait();
+    }
+
+private:
+    ThreadPool & m_pool;
+    mutex & m_lock;
+    int & m_count;
+};
+
+//-*****************************************************************************
+void taskGroupTest()
+{
+    mutex lock;
+    int count = 0;
+    int otherCount = 0;
+
+    ThreadPool pool( 2 );
+    {
+        TaskGroup group( pool );
+        for ( int i = 0; i < 100; ++i )
+        {
+            group.add( TaskPtr( new CountTask( lock, count ) ) );
+        }
+
+        // errors of tasks outside of the group go to the pool
+        pool.add( TaskPtr( new CountTask( lock, otherCount, true ) ) );
+
+        group.wait();
+        assert( count == 100 );
+
+        bool caught = false;
+        try
+        {
+            pool.wait();
+        }
+        catch ( Exception & e )
+        {
+            caught = true;
+        }
+        assert( caught );
+
+        // and the group's own go to the group
+        group.add( TaskPtr( new CountTask( lock, count, true ) ) );
+        caught = false;
+        try
+        {
+            group.wait();
+        }
+        catch ( Exception & e )
+        {
+            caught = ( std::string( e.what() ) == "Told to throw" );
+        }
+        assert( caught );
+        pool.wait();
+    }
+
+    // waiting from the pool's own threads, even when every one of them is
+    // waiting, runs the group's tasks instead of hanging
+    ThreadPool single( 1 );
+    count = 0;
+    for ( int i = 0; i < 5; ++i )
+    {
+        single.add( TaskPtr( new GroupTask( single, lock, count ) ) );
+    }
+    single.wait();
+    assert( count == 50 );
+
+    // going away waits for the tasks too
+    count = 0;
+    {
+        TaskGroup group( pool );
+        for ( int i = 0; i < 100; ++i )
+        {
+            group.add( TaskPtr( new CountTask( lock, count ) ) );
+        }
+    }
+    assert( count == 100 );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    mutex lock;
+    int count = 0;
+
+    {
+        ThreadPool pool( 4 );
+        assert( pool.getNumThreads() == 4 );
+
+        for ( int i = 0; i < 1000; ++i )
+        {
+            pool.add( TaskPtr( new CountTask( lock, count ) ) );
+        }
+        pool.wait();
+        assert( count == 1000 );
+
+        // the pool can be reused after waiting
+        for ( int i = 0; i < 10; ++i )
+        {
+            pool.add( TaskPtr( new CountTask( lock, count ) ) );
+        }
+        pool.wait();
+        assert( count == 1010 );
+
+        // a throwing task doesn't stop the rest, and is reported by wait
+        pool.add( TaskPtr( new CountTask( lock, count, true ) ) );
+        pool.add( TaskPtr( new CountTask( lock, count ) ) );
+
+        bool caught = false;
+        try
+        {
+            pool.wait();
+        }
+        catch ( Exception & e )
+        {
+            caught = ( std::string( e.what() ) == "Told to throw" );
+        }
+        assert( caught );
+        assert( count == 1011 );
+
+        // only reported once
+        pool.wait();
+
+        // waiting with nothing to do returns straight away
+        pool.cancel();
+        pool.wait();
+    }
+
+    taskGroupTest();
+
+    // the default uses every core
+    ThreadPool pool;
+    assert( pool.getNumThreads() == ThreadPool::getNumCores() );
+
+    std::cout << "Success!" << std::endl;
+    return 0;
+}
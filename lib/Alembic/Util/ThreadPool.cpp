@@ -0,0 +1,480 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+
+#include <Alembic/Util/ThreadPool.h>
+#include <Alembic/Util/Exception.h>
+
+#include <deque>
+
+#ifndef _MSC_VER
+#include <unistd.h>
+#endif
+
+namespace Alembic {
+namespace Util {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+class ThreadPool::PrivateData
+{
+public:
+    PrivateData() : numRunning( 0 ), stopping( false )
+    {
+#ifdef _MSC_VER
+        InitializeCriticalSection( &lock );
+        InitializeConditionVariable( &workCond );
+        InitializeConditionVariable( &idleCond );
+        InitializeConditionVariable( &groupCond );
+#else
+        pthread_mutex_init( &lock, NULL );
+        pthread_cond_init( &workCond, NULL );
+        pthread_cond_init( &idleCond, NULL );
+        pthread_cond_init( &groupCond, NULL );
+#endif
+    }
+
+    ~PrivateData()
+    {
+#ifdef _MSC_VER
+        DeleteCriticalSection( &lock );
+#else
+        pthread_cond_destroy( &groupCond );
+        pthread_cond_destroy( &idleCond );
+        pthread_cond_destroy( &workCond );
+        pthread_mutex_destroy( &lock );
+#endif
+    }
+
+    void acquire()
+    {
+#ifdef _MSC_VER
+        EnterCriticalSection( &lock );
+#else
+        pthread_mutex_lock( &lock );
+#endif
+    }
+
+    void release()
+    {
+#ifdef _MSC_VER
+        LeaveCriticalSection( &lock );
+#else
+        pthread_mutex_unlock( &lock );
+#endif
+    }
+
+#ifdef _MSC_VER
+    void waitOn( CONDITION_VARIABLE & iCond )
+    {
+        SleepConditionVariableCS( &iCond, &lock, INFINITE );
+    }
+
+    void wakeAll( CONDITION_VARIABLE & iCond )
+    {
+        WakeAllConditionVariable( &iCond );
+    }
+
+    void wakeOne( CONDITION_VARIABLE & iCond )
+    {
+        WakeConditionVariable( &iCond );
+    }
+#else
+    void waitOn( pthread_cond_t & iCond )
+    {
+        pthread_cond_wait( &iCond, &lock );
+    }
+
+    void wakeAll( pthread_cond_t & iCond )
+    {
+        pthread_cond_broadcast( &iCond );
+    }
+
+    void wakeOne( pthread_cond_t & iCond )
+    {
+        pthread_cond_signal( &iCond );
+    }
+#endif
+
+    // runs tasks until we are stopped
+    void work()
+    {
+        acquire();
+        for ( ;; )
+        {
+            while ( tasks.empty() && !stopping )
+            {
+                waitOn( workCond );
+            }
+
+            if ( tasks.empty() )
+            {
+                break;
+            }
+
+            TaskPtr task = tasks.front();
+            tasks.pop_front();
+            ++numRunning;
+            release();
+
+            std::string message;
+            try
+            {
+                task->run();
+            }
+            catch ( std::exception & e )
+            {
+                message = e.what();
+            }
+            catch ( ... )
+            {
+                message = "Unknown exception thrown by a ThreadPool task";
+            }
+
+            // let go of the task before we say we're done with it
+            task.reset();
+
+            acquire();
+            if ( !message.empty() && error.empty() )
+            {
+                error = message;
+            }
+
+            --numRunning;
+            if ( tasks.empty() && numRunning == 0 )
+            {
+                wakeAll( idleCond );
+            }
+        }
+        release();
+    }
+
+#ifdef _MSC_VER
+    static DWORD WINAPI threadMain( LPVOID iData )
+    {
+        static_cast< PrivateData * >( iData )->work();
+        return 0;
+    }
+
+    CRITICAL_SECTION lock;
+    CONDITION_VARIABLE workCond;
+    CONDITION_VARIABLE idleCond;
+    CONDITION_VARIABLE groupCond;
+    std::vector< HANDLE > threads;
+#else
+    static void * threadMain( void * iData )
+    {
+        static_cast< PrivateData * >( iData )->work();
+        return NULL;
+    }
+
+    pthread_mutex_t lock;
+    pthread_cond_t workCond;
+    pthread_cond_t idleCond;
+    pthread_cond_t groupCond;
+    std::vector< pthread_t > threads;
+#endif
+
+    std::deque< TaskPtr > tasks;
+    std::size_t numRunning;
+    bool stopping;
+
+    // the first message thrown by a task since the last wait
+    std::string error;
+};
+
+//-*****************************************************************************
+ThreadPool::ThreadPool( std::size_t iNumThreads )
+    : m_data( new PrivateData() )
+{
+    if ( iNumThreads == 0 )
+    {
+        iNumThreads = getNumCores();
+    }
+
+    m_data->threads.reserve( iNumThreads );
+    for ( std::size_t i = 0; i < iNumThreads; ++i )
+    {
+#ifdef _MSC_VER
+        HANDLE thread = CreateThread( NULL, 0, PrivateData::threadMain,
+                                      m_data.get(), 0, NULL );
+        if ( thread != NULL )
+        {
+            m_data->threads.push_back( thread );
+        }
+#else
+        pthread_t thread;
+        if ( pthread_create( &thread, NULL, PrivateData::threadMain,
+                             m_data.get() ) == 0 )
+        {
+            m_data->threads.push_back( thread );
+        }
+#endif
+    }
+
+    if ( m_data->threads.empty() )
+    {
+        ALEMBIC_THROW( "Couldn't start any ThreadPool threads." );
+    }
+}
+
+//-*****************************************************************************
+ThreadPool::~ThreadPool()
+{
+    m_data->acquire();
+    m_data->tasks.clear();
+    m_data->stopping = true;
+    m_data->wakeAll( m_data->workCond );
+    m_data->release();
+
+    for ( std::size_t i = 0; i < m_data->threads.size(); ++i )
+    {
+#ifdef _MSC_VER
+        WaitForSingleObject( m_data->threads[i], INFINITE );
+        CloseHandle( m_data->threads[i] );
+#else
+        pthread_join( m_data->threads[i], NULL );
+#endif
+    }
+}
+
+//-*****************************************************************************
+void ThreadPool::add( TaskPtr iTask )
+{
+    if ( !iTask )
+    {
+        return;
+    }
+
+    m_data->acquire();
+    m_data->tasks.push_back( iTask );
+    m_data->wakeOne( m_data->workCond );
+    m_data->release();
+}
+
+//-*****************************************************************************
+void ThreadPool::wait()
+{
+    m_data->acquire();
+    while ( !m_data->tasks.empty() || m_data->numRunning > 0 )
+    {
+        m_data->waitOn( m_data->idleCond );
+    }
+
+    std::string error;
+    error.swap( m_data->error );
+    m_data->release();
+
+    if ( !error.empty() )
+    {
+        ALEMBIC_THROW( error );
+    }
+}
+
+//-*****************************************************************************
+void ThreadPool::cancel()
+{
+    m_data->acquire();
+    m_data->tasks.clear();
+    if ( m_data->numRunning == 0 )
+    {
+        m_data->wakeAll( m_data->idleCond );
+    }
+    m_data->release();
+}
+
+//-*****************************************************************************
+std::size_t ThreadPool::getNumThreads() const
+{
+    return m_data->threads.size();
+}
+
+//-*****************************************************************************
+std::size_t ThreadPool::getNumCores()
+{
+#ifdef _MSC_VER
+    SYSTEM_INFO info;
+    GetSystemInfo( &info );
+    long numCores = info.dwNumberOfProcessors;
+#else
+    long numCores = sysconf( _SC_NPROCESSORS_ONLN );
+#endif
+
+    if ( numCores < 1 )
+    {
+        return 1;
+    }
+
+    return ( std::size_t ) numCores;
+}
+
+//-*****************************************************************************
+// Everything here is protected by the pool's lock.  The pool is handed a
+// Runner for every task added, which runs whichever of the group's tasks is
+// next, if any are left by the time it gets to it.
+class TaskGroup::PrivateData
+{
+public:
+    explicit PrivateData( ThreadPool::PrivateData * iPool )
+        : pool( iPool ), numRunning( 0 ) {}
+
+    // expects the lock to be held, and hands it back held
+    void runNext()
+    {
+        TaskPtr task = tasks.front();
+        tasks.pop_front();
+        ++numRunning;
+        pool->release();
+
+        std::string message;
+        try
+        {
+            task->run();
+        }
+        catch ( std::exception & e )
+        {
+            message = e.what();
+        }
+        catch ( ... )
+        {
+            message = "Unknown exception thrown by a TaskGroup task";
+        }
+
+        task.reset();
+
+        pool->acquire();
+        if ( !message.empty() && error.empty() )
+        {
+            error = message;
+        }
+
+        --numRunning;
+        if ( tasks.empty() && numRunning == 0 )
+        {
+            pool->wakeAll( pool->groupCond );
+        }
+    }
+
+    // runs what is left on this thread, then waits for the rest, expects
+    // the lock to be held
+    void finish()
+    {
+        while ( !tasks.empty() )
+        {
+            runNext();
+        }
+
+        while ( numRunning > 0 )
+        {
+            pool->waitOn( pool->groupCond );
+        }
+    }
+
+    ThreadPool::PrivateData * pool;
+    std::deque< TaskPtr > tasks;
+    std::size_t numRunning;
+    std::string error;
+
+    class Runner : public Task
+    {
+    public:
+        explicit Runner( shared_ptr< PrivateData > iGroup )
+            : m_group( iGroup ) {}
+
+        virtual void run()
+        {
+            m_group->pool->acquire();
+            if ( !m_group->tasks.empty() )
+            {
+                m_group->runNext();
+            }
+            m_group->pool->release();
+        }
+
+    private:
+        shared_ptr< PrivateData > m_group;
+    };
+};
+
+//-*****************************************************************************
+TaskGroup::TaskGroup( ThreadPool & iPool )
+    : m_data( new PrivateData( iPool.m_data.get() ) )
+{
+}
+
+//-*****************************************************************************
+TaskGroup::~TaskGroup()
+{
+    m_data->pool->acquire();
+    m_data->finish();
+    m_data->pool->release();
+}
+
+//-*****************************************************************************
+void TaskGroup::add( TaskPtr iTask )
+{
+    if ( !iTask )
+    {
+        return;
+    }
+
+    ThreadPool::PrivateData * pool = m_data->pool;
+    pool->acquire();
+    m_data->tasks.push_back( iTask );
+    pool->tasks.push_back( TaskPtr( new PrivateData::Runner( m_data ) ) );
+    pool->wakeOne( pool->workCond );
+    pool->release();
+}
+
+//-*****************************************************************************
+void TaskGroup::wait()
+{
+    m_data->pool->acquire();
+    m_data->finish();
+
+    std::string error;
+    error.swap( m_data->error );
+    m_data->pool->release();
+
+    if ( !error.empty() )
+    {
+        ALEMBIC_THROW( error );
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace Util
+} // End namespace Alembic
@@ -0,0 +1,132 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+
+#ifndef _Alembic_Util_ThreadPool_h_
+#define _Alembic_Util_ThreadPool_h_
+
+#include <Alembic/Util/Foundation.h>
+
+namespace Alembic {
+namespace Util {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! A unit of work for the ThreadPool, run is called on one of the pool's
+//! threads.  If run throws, the message is handed back by ThreadPool::wait.
+class Task
+{
+public:
+    virtual ~Task() {}
+    virtual void run() = 0;
+};
+
+typedef shared_ptr< Task > TaskPtr;
+
+//-*****************************************************************************
+//! A fixed number of threads which run Tasks in the order they were added.
+class ThreadPool : noncopyable
+{
+public:
+    //! Starts iNumThreads threads, if iNumThreads is 0 then one thread per
+    //! core is started.
+    explicit ThreadPool( std::size_t iNumThreads = 0 );
+
+    //! Throws away the tasks which haven't started yet, and waits for the
+    //! running ones to finish.
+    ~ThreadPool();
+
+    //! Queues up a task to be run.
+    void add( TaskPtr iTask );
+
+    //! Waits until every task that has been added has been run.  If any of
+    //! them threw since the last wait, an exception with the first message
+    //! is thrown.  This shouldn't be called from one of the pool's tasks.
+    void wait();
+
+    //! Throws away the tasks which haven't started yet, the ones that are
+    //! running are left to finish.
+    void cancel();
+
+    std::size_t getNumThreads() const;
+
+    //! The number of cores on this machine, or 1 if it can't be found.
+    static std::size_t getNumCores();
+
+private:
+    friend class TaskGroup;
+
+    class PrivateData;
+    auto_ptr< PrivateData > m_data;
+};
+
+typedef shared_ptr< ThreadPool > ThreadPoolPtr;
+
+//-*****************************************************************************
+//! Tasks run by a ThreadPool which can be waited on apart from the rest of
+//! the pool's tasks, so several callers can share one pool.  Waiting runs
+//! the group's tasks which haven't started yet on the calling thread, so it
+//! is fine to wait from one of the pool's own tasks.  The pool has to
+//! outlive the group.
+class TaskGroup : noncopyable
+{
+public:
+    explicit TaskGroup( ThreadPool & iPool );
+
+    //! Waits for the tasks that have been added, any errors are dropped.
+    ~TaskGroup();
+
+    //! Queues up a task to be run by the pool.
+    void add( TaskPtr iTask );
+
+    //! Waits until every task added to this group has been run.  If any of
+    //! them threw since the last wait, an exception with the first message
+    //! is thrown.
+    void wait();
+
+private:
+    class PrivateData;
+    shared_ptr< PrivateData > m_data;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Util
+} // End namespace Alembic
+
+#endif
@@ -334,7 +334,10 @@ Subdivide( RtPointer data, RtFloat detail )
 
     try
     {
+        // every procedural for the same file shares one open archive
         ::Alembic::AbcCoreFactory::IFactory factory;
+        factory.setArchivePool(
+            ::Alembic::AbcCoreFactory::ArchivePool::getShared() );
         IArchive archive = factory.getArchive( args->filename );
 
         IObject root = archive.getTop();
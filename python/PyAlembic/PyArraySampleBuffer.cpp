@@ -0,0 +1,268 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2012,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Foundation.h>
+#include <PyArraySampleBuffer.h>
+
+using namespace boost::python;
+
+//-*****************************************************************************
+ArraySampleBuffer::ArraySampleBuffer( AbcA::ArraySamplePtr iSample )
+  : m_sample( iSample )
+{
+    const AbcA::DataType &dt = m_sample->getDataType();
+    Py_ssize_t itemSize = AbcU::PODNumBytes( dt.getPod() );
+
+    m_shape[0] = m_sample->size();
+    m_shape[1] = dt.getExtent();
+    m_strides[0] = itemSize * dt.getExtent();
+    m_strides[1] = itemSize;
+}
+
+//-*****************************************************************************
+int ArraySampleBuffer::getBuffer( PyObject *iExporter, Py_buffer *oView,
+                                  int iFlags )
+{
+    oView->obj = NULL;
+
+    if ( ( iFlags & PyBUF_WRITABLE ) == PyBUF_WRITABLE )
+    {
+        PyErr_SetString( PyExc_BufferError,
+                         "ArraySampleBuffer is read only" );
+        return -1;
+    }
+
+    const char *format = m_sample ?
+        PODBufferFormat( m_sample->getDataType().getPod() ) : NULL;
+
+    if ( !format )
+    {
+        PyErr_SetString( PyExc_BufferError,
+                         "ArraySampleBuffer has no data which can be viewed" );
+        return -1;
+    }
+
+    const AbcA::DataType &dt = m_sample->getDataType();
+
+    oView->obj = iExporter;
+    Py_INCREF( iExporter );
+
+    oView->buf = const_cast<void *>( m_sample->getData() );
+    oView->len = m_shape[0] * m_strides[0];
+    oView->readonly = 1;
+    oView->format = ( iFlags & PyBUF_FORMAT ) == PyBUF_FORMAT ?
+        const_cast<char *>( format ) : NULL;
+
+    if ( ( iFlags & PyBUF_ND ) == PyBUF_ND )
+    {
+        oView->itemsize = m_strides[1];
+        oView->ndim = dt.getExtent() > 1 ? 2 : 1;
+        oView->shape = m_shape;
+        oView->strides = ( iFlags & PyBUF_STRIDES ) == PyBUF_STRIDES ?
+            m_strides : NULL;
+    }
+    else
+    {
+        // without PyBUF_ND it's looked at as just bytes
+        oView->itemsize = 1;
+        oView->ndim = 1;
+        oView->shape = NULL;
+        oView->strides = NULL;
+    }
+    oView->suboffsets = NULL;
+    oView->internal = NULL;
+
+    return 0;
+}
+
+//-*****************************************************************************
+const char * PODBufferFormat( AbcU::PlainOldDataType iPod )
+{
+    switch ( iPod )
+    {
+        case AbcU::kBooleanPOD: return "?";
+        case AbcU::kUint8POD: return "B";
+        case AbcU::kInt8POD: return "b";
+        case AbcU::kUint16POD: return "H";
+        case AbcU::kInt16POD: return "h";
+        case AbcU::kUint32POD: return "I";
+        case AbcU::kInt32POD: return "i";
+        case AbcU::kUint64POD: return "Q";
+        case AbcU::kInt64POD: return "q";
+        case AbcU::kFloat16POD: return "e";
+        case AbcU::kFloat32POD: return "f";
+        case AbcU::kFloat64POD: return "d";
+        default: return NULL;
+    }
+}
+
+//-*****************************************************************************
+namespace {
+
+// which kind of number a struct module format character is, the size is
+// checked separately
+char formatKind( char iFormat )
+{
+    switch ( iFormat )
+    {
+        case '?':
+            return '?';
+        case 'b': case 'h': case 'i': case 'l': case 'q': case 'n':
+            return 'i';
+        case 'B': case 'H': case 'I': case 'L': case 'Q': case 'N':
+            return 'u';
+        case 'e': case 'f': case 'd':
+            return 'f';
+        default:
+            return 0;
+    }
+}
+
+bool isLittleEndian()
+{
+    const AbcU::uint16_t one = 1;
+    return *reinterpret_cast<const AbcU::uint8_t *>( &one ) == 1;
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+bool BufferMatchesPOD( const Py_buffer &iView, AbcU::PlainOldDataType iPod )
+{
+    const char *podFormat = PODBufferFormat( iPod );
+    if ( !podFormat ||
+         iView.itemsize != ( Py_ssize_t ) AbcU::PODNumBytes( iPod ) )
+    {
+        return false;
+    }
+
+    // no format means unsigned bytes
+    const char *format = iView.format ? iView.format : "B";
+
+    switch ( *format )
+    {
+        case '@': case '=':
+            ++format;
+            break;
+        case '<':
+            if ( !isLittleEndian() ) { return false; }
+            ++format;
+            break;
+        case '>': case '!':
+            if ( isLittleEndian() ) { return false; }
+            ++format;
+            break;
+        default:
+            break;
+    }
+
+    return format[0] != '\0' && format[1] == '\0' &&
+        formatKind( format[0] ) == formatKind( podFormat[0] );
+}
+
+//-*****************************************************************************
+BufferView::BufferView( PyObject *iObj, const AbcA::DataType &iType )
+  : m_valid( false ), m_size( 0 )
+{
+    if ( !PyObject_CheckBuffer( iObj ) ||
+         PyObject_GetBuffer( iObj, &m_view,
+                             PyBUF_C_CONTIGUOUS | PyBUF_FORMAT ) != 0 )
+    {
+        PyErr_Clear();
+        return;
+    }
+
+    Py_ssize_t elementSize = iType.getNumBytes();
+    m_valid = BufferMatchesPOD( m_view, iType.getPod() ) &&
+        m_view.len % elementSize == 0 &&
+        ( m_view.ndim <= 1 ||
+          m_view.shape[m_view.ndim - 1] == iType.getExtent() );
+
+    if ( !m_valid )
+    {
+        PyBuffer_Release( &m_view );
+        return;
+    }
+
+    m_size = m_view.len / elementSize;
+}
+
+//-*****************************************************************************
+BufferView::~BufferView()
+{
+    if ( m_valid )
+    {
+        PyBuffer_Release( &m_view );
+    }
+}
+
+//-*****************************************************************************
+static int getBuffer( PyObject *iExporter, Py_buffer *oView, int iFlags )
+{
+    extract<ArraySampleBuffer &> buffer( iExporter );
+    if ( !buffer.check() )
+    {
+        PyErr_SetString( PyExc_BufferError, "Not an ArraySampleBuffer" );
+        oView->obj = NULL;
+        return -1;
+    }
+
+    return buffer().getBuffer( iExporter, oView, iFlags );
+}
+
+//-*****************************************************************************
+void register_arraysamplebuffer()
+{
+    static PyBufferProcs bufferProcs;
+    bufferProcs.bf_getbuffer = &getBuffer;
+    bufferProcs.bf_releasebuffer = NULL;
+
+    class_<ArraySampleBuffer> cls(
+        "ArraySampleBuffer",
+        "The ArraySampleBuffer class shares the data of an array sample "
+        "through the buffer protocol, numpy.asarray or memoryview of it "
+        "don't copy the data",
+        no_init );
+    cls.def( "__len__", &ArraySampleBuffer::len );
+
+    // boost.python has no say in the buffer slots, so they're filled in
+    // on the class it made
+    PyTypeObject *type = reinterpret_cast<PyTypeObject *>( cls.ptr() );
+    type->tp_as_buffer = &bufferProcs;
+#if PY_MAJOR_VERSION < 3
+    type->tp_flags |= Py_TPFLAGS_HAVE_NEWBUFFER;
+#endif
+}
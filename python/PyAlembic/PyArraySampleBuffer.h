@@ -0,0 +1,106 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2012,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef PyAlembic_PyArraySampleBuffer_h_
+#define PyAlembic_PyArraySampleBuffer_h_
+
+#include <Foundation.h>
+
+//-*****************************************************************************
+//! Hands out the data of an ArraySample through the Python buffer protocol,
+//! so memoryview or numpy.asarray look at the sample itself instead of a
+//! copy of it.  The sample is kept around for as long as this or any view
+//! of it is.  Views are read only, and are laid out as one row per element
+//! with a column per component.
+class ArraySampleBuffer
+{
+public:
+    ArraySampleBuffer() {}
+    explicit ArraySampleBuffer( AbcA::ArraySamplePtr iSample );
+
+    AbcA::ArraySamplePtr getSample() const { return m_sample; }
+
+    //! The number of elements in the sample.
+    size_t len() const { return m_sample ? m_sample->size() : 0; }
+
+    //! Fills in oView as asked for by iFlags, or sets a BufferError and
+    //! returns -1.
+    int getBuffer( PyObject *iExporter, Py_buffer *oView, int iFlags );
+
+private:
+    AbcA::ArraySamplePtr m_sample;
+    Py_ssize_t m_shape[2];
+    Py_ssize_t m_strides[2];
+};
+
+//-*****************************************************************************
+//! The struct module format character for iPod, or NULL for strings which
+//! can't be viewed as a buffer.
+const char * PODBufferFormat( AbcU::PlainOldDataType iPod );
+
+//! Whether iView holds data in the native byte order with the same size
+//! and kind of number as iPod.
+bool BufferMatchesPOD( const Py_buffer &iView, AbcU::PlainOldDataType iPod );
+
+//-*****************************************************************************
+//! Holds onto a C contiguous view of a Python buffer for as long as it is
+//! around, so the memory a sample points at can't be resized or freed out
+//! from under it, even while the GIL is let go of.  The view is only taken
+//! if it holds iType's numbers and, when it has more than one dimension,
+//! its last dimension is iType's extent.  Has to go away with the GIL held.
+class BufferView
+{
+public:
+    BufferView( PyObject *iObj, const AbcA::DataType &iType );
+    ~BufferView();
+
+    bool valid() const { return m_valid; }
+
+    const void * data() const { return m_view.buf; }
+
+    //! The number of iType elements in the buffer.
+    size_t size() const { return m_size; }
+
+private:
+    BufferView( const BufferView & );
+    BufferView & operator=( const BufferView & );
+
+    Py_buffer m_view;
+    bool m_valid;
+    size_t m_size;
+};
+
+#endif
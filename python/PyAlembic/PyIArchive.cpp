@@ -35,12 +35,28 @@
 //-*****************************************************************************
 
 #include <Foundation.h>
+#include <PyReleaseGIL.h>
 
 using namespace boost::python;
 
 //-*****************************************************************************
 static Abc::IArchive* mkIArchive( const std::string &iName )
 {
+    // Ogawa archives are opened without the GIL and memory mapped, so
+    // threads reading them with the GIL let go of don't wait on each other
+    // and each archive only needs the one file handle.  Anything else is
+    // left to the factory, which also tries HDF5
+    {
+        ReleaseGIL release( true );
+        AbcO::ReadArchive reader( 1, true );
+        Abc::IArchive archive( reader, iName,
+                               Abc::ErrorHandler::kQuietNoopPolicy );
+        if ( archive.valid() )
+        {
+            return new Abc::IArchive( archive );
+        }
+    }
+
     Abc::IArchive archive;
     AbcF::IFactory factory;
     factory.setPolicy(Abc::ErrorHandler::kQuietNoopPolicy);
@@ -53,6 +69,68 @@ static Abc::IArchive* mkIArchive( const std::string &iName )
     }
 }
 
+//-*****************************************************************************
+namespace {
+
+//-*****************************************************************************
+class FindTask : public AbcU::Task
+{
+public:
+    FindTask( const Abc::IArchive &iArchive, const std::string &iFullName,
+              Abc::IObject &oObject )
+        : m_archive( iArchive ), m_fullName( iFullName ), m_object( oObject )
+    {}
+
+    virtual void run() { m_object = m_archive.findObject( m_fullName ); }
+
+private:
+    Abc::IArchive m_archive;
+    std::string m_fullName;
+    Abc::IObject &m_object;
+};
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+static list findObjects( Abc::IArchive &iArchive, object iFullNames,
+                         std::size_t iNumThreads )
+{
+    std::vector<std::string> fullNames;
+    stl_input_iterator<std::string> nameIter( iFullNames ), nameEnd;
+    for ( ; nameIter != nameEnd; ++nameIter )
+    {
+        fullNames.push_back( *nameIter );
+    }
+
+    std::vector<Abc::IObject> objects( fullNames.size() );
+    if ( iArchive.valid() && iArchive.getPtr()->supportsConcurrentReads() )
+    {
+        ReleaseGIL release( true );
+        AbcU::ThreadPool pool( iNumThreads );
+        for ( std::size_t i = 0; i < fullNames.size(); ++i )
+        {
+            pool.add( AbcU::TaskPtr(
+                new FindTask( iArchive, fullNames[i], objects[i] ) ) );
+        }
+        pool.wait();
+    }
+    else
+    {
+        for ( std::size_t i = 0; i < fullNames.size(); ++i )
+        {
+            objects[i] = iArchive.findObject( fullNames[i] );
+        }
+    }
+
+    list found;
+    for ( std::size_t i = 0; i < objects.size(); ++i )
+    {
+        found.append( objects[i] );
+    }
+
+    return found;
+}
+
 //-*****************************************************************************
 void register_iarchive()
 {
@@ -67,7 +145,9 @@ void register_iarchive()
                   mkIArchive,
                   default_call_policies(),
                   ( arg( "fileName" ) ) ),
-             "Create an IArchive with the given file name" )
+             "Create an IArchive with the given file name.  Ogawa archives "
+             "are memory mapped, so any number of threads can read from "
+             "them at once" )
         .def( "getName",
               &Abc::IArchive::getName,
               "Return the file name" )
@@ -75,6 +155,19 @@ void register_iarchive()
               &Abc::IArchive::getTop,
               "Return the single top-level IObject",
               with_custodian_and_ward_postcall<0,1>() )
+        .def( "findObject",
+              &Abc::IArchive::findObject,
+              ( arg( "fullName" ) ),
+              "Return the IObject with the given full name, without opening "
+              "the objects above it when the archive allows",
+              with_custodian_and_ward_postcall<0,1>() )
+        .def( "findObjects",
+              &findObjects,
+              ( arg( "fullNames" ), arg( "numThreads" ) = 0 ),
+              "Return a list with the IObject for each of the given full "
+              "names.  They are found by numThreads threads (one per core "
+              "when 0) without holding the GIL when the archive can be read "
+              "from several threads" )
         .def( "getTimeSampling",
               &Abc::IArchive::getTimeSampling,
               ( arg( "index" ) ),
@@ -38,6 +38,8 @@
 #include <PyIBaseProperty.h>
 #include <PyIPropertyUtil.h>
 #include <PyTypeBindingUtil.h>
+#include <PyArraySampleBuffer.h>
+#include <PyReleaseGIL.h>
 
 using namespace boost::python;
 
@@ -63,30 +65,13 @@ case TPTraits::pod_enum:                                   \
 }
 
 //-*****************************************************************************
-template<>
-object getValue ( Abc::IArrayProperty &p, 
-                         const Abc::ISampleSelector &iSS,
-                         const ReturnTypeEnum returnType )
+//! Converts a sample read from p into the Python array for its type.
+static object getPythonValue( Abc::IArrayProperty &p,
+                              AbcA::ArraySamplePtr &ptr )
 {
-    // Determine the type & extent of the array property and return its value.
     const AbcA::DataType &dt = p.getDataType();
     AbcU::PlainOldDataType pod = dt.getPod();
     const AbcU::uint8_t extent = dt.getExtent();
-    AbcU::Dimensions dims;
-    p.getDimensions( dims, iSS );
-
-    // POD data types
-    if( pod < 0 || pod >= AbcU::kNumPlainOldDataTypes )
-    {
-        std::stringstream stream;
-        stream << "ERROR: Unhandled type " << AbcU::PODName (pod)
-               << " with extent " << (int)extent;
-        throwPythonException( stream.str().c_str() );
-        return object(); // Returns None object
-    }
-
-    AbcA::ArraySamplePtr ptr;
-    p.get( ptr, iSS );
 
     if (extent == 1)
     {
@@ -215,6 +200,118 @@ object getValue ( Abc::IArrayProperty &p,
     return object(); // Returns None object
 }
 
+//-*****************************************************************************
+template<>
+object getValue ( Abc::IArrayProperty &p, 
+                         const Abc::ISampleSelector &iSS,
+                         const ReturnTypeEnum returnType )
+{
+    // Determine the type & extent of the array property and return its value.
+    const AbcA::DataType &dt = p.getDataType();
+    AbcU::PlainOldDataType pod = dt.getPod();
+    const AbcU::uint8_t extent = dt.getExtent();
+
+    // POD data types
+    if( pod < 0 || pod >= AbcU::kNumPlainOldDataTypes )
+    {
+        std::stringstream stream;
+        stream << "ERROR: Unhandled type " << AbcU::PODName (pod)
+               << " with extent " << (int)extent;
+        throwPythonException( stream.str().c_str() );
+        return object(); // Returns None object
+    }
+
+    AbcA::ArraySamplePtr ptr;
+    {
+        ReleaseGIL release( ReadsConcurrently( p ) );
+        p.get( ptr, iSS );
+    }
+
+    return getPythonValue( p, ptr );
+}
+
+//-*****************************************************************************
+namespace {
+
+//-*****************************************************************************
+class GetTask : public AbcU::Task
+{
+public:
+    GetTask( const Abc::IArrayProperty &iProp,
+             const Abc::ISampleSelector &iSS,
+             AbcA::ArraySamplePtr &oSample )
+        : m_prop( iProp ), m_ss( iSS ), m_sample( oSample ) {}
+
+    virtual void run() { m_prop.get( m_sample, m_ss ); }
+
+private:
+    Abc::IArrayProperty m_prop;
+    Abc::ISampleSelector m_ss;
+    AbcA::ArraySamplePtr &m_sample;
+};
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+static list getArrayValues( object iProps,
+                            const Abc::ISampleSelector &iSS,
+                            std::size_t iNumThreads )
+{
+    std::vector<Abc::IArrayProperty> props;
+    stl_input_iterator<Abc::IArrayProperty> propIter( iProps ), propEnd;
+    for ( ; propIter != propEnd; ++propIter )
+    {
+        props.push_back( *propIter );
+    }
+
+    std::vector<AbcA::ArraySamplePtr> samps( props.size() );
+
+    // the pool reads what it can without the GIL, HDF5 properties are
+    // read here with it held in the meantime
+    AbcU::ThreadPoolPtr pool;
+    for ( std::size_t i = 0; i < props.size(); ++i )
+    {
+        if ( ReadsConcurrently( props[i] ) )
+        {
+            if ( !pool )
+            {
+                pool.reset( new AbcU::ThreadPool( iNumThreads ) );
+            }
+            pool->add( AbcU::TaskPtr( new GetTask( props[i], iSS,
+                                                   samps[i] ) ) );
+        }
+    }
+
+    for ( std::size_t i = 0; i < props.size(); ++i )
+    {
+        if ( !ReadsConcurrently( props[i] ) )
+        {
+            props[i].get( samps[i], iSS );
+        }
+    }
+
+    if ( pool )
+    {
+        ReleaseGIL release( true );
+        pool->wait();
+    }
+
+    list values;
+    for ( std::size_t i = 0; i < props.size(); ++i )
+    {
+        if ( samps[i] )
+        {
+            values.append( getPythonValue( props[i], samps[i] ) );
+        }
+        else
+        {
+            values.append( object() );
+        }
+    }
+
+    return values;
+}
+
 //-*****************************************************************************
 static object getDimension( Abc::IArrayProperty& p, 
                             const Abc::ISampleSelector& iSS )
@@ -238,6 +335,27 @@ static std::string getKey( Abc::IArrayProperty &p,
     return std::string();
 }
 
+//-*****************************************************************************
+static ArraySampleBuffer getBuffer( Abc::IArrayProperty &p,
+                                    const Abc::ISampleSelector &iSS )
+{
+    if ( !PODBufferFormat( p.getDataType().getPod() ) )
+    {
+        std::stringstream stream;
+        stream << "ERROR: " << AbcU::PODName( p.getDataType().getPod() )
+               << " samples can't be viewed as a buffer";
+        throwPythonException( stream.str().c_str() );
+    }
+
+    AbcA::ArraySamplePtr ptr;
+    {
+        ReleaseGIL release( ReadsConcurrently( p ) );
+        p.get( ptr, iSS );
+    }
+
+    return ArraySampleBuffer( ptr );
+}
+
 //-*****************************************************************************
 void register_iarrayproperty()
 {
@@ -309,6 +427,12 @@ void register_iarrayproperty()
               Overloads::getAllValue,
               ( arg( "iSS" ) = Abc::ISampleSelector() ),
               "Return the sample with the given ISampleSelector" )
+        .def( "getBuffer",
+              &getBuffer,
+              ( arg( "iSS" ) = Abc::ISampleSelector() ),
+              "Return the sample with the given ISampleSelector as an "
+              "ArraySampleBuffer, which numpy.asarray or memoryview can "
+              "look at without copying it" )
         .def( "getDimension", &getDimension )
         .def( "getParent",
               &Abc::IArrayProperty::getParent,
@@ -335,4 +459,13 @@ void register_iarrayproperty()
         ( "ArraySampleIterator", no_init )
         .def ( "next", &SampleIterator<Abc::IArrayProperty>::next )
         ;
+
+    def( "GetArrayValues",
+         getArrayValues,
+         ( arg( "properties" ), arg( "iSS" ) = Abc::ISampleSelector(),
+           arg( "numThreads" ) = 0 ),
+         "Return a list with the sample of each of the given IArrayProperty "
+         "objects at the given ISampleSelector.  Properties of archives "
+         "which can be read from several threads are read by numThreads "
+         "threads (one per core when 0) without holding the GIL" );
  }
@@ -35,9 +35,20 @@
 //-*****************************************************************************
 
 #include <Foundation.h>
+#include <PyReleaseGIL.h>
 
 using namespace boost::python;
 
+//-*****************************************************************************
+//! Opening a child reads its header and properties, so other Python threads
+//! are let run in the meantime when the archive allows.
+template <class KEY>
+static Abc::IObject getChildWithoutGIL( const Abc::IObject &o, const KEY &k )
+{
+    ReleaseGIL release( ReadsConcurrently( o ) );
+    return o.getChild( k );
+}
+
 //-*****************************************************************************
 class ChildIterator
 {
@@ -50,7 +61,7 @@ public:
         if ( _iter >= _end )
             boost::python::objects::stop_iteration_error();
 
-        return _p.getChild( _iter++ );
+        return getChildWithoutGIL( _p, _iter++ );
     }
 private:
     Abc::IObject _p;
@@ -72,7 +83,7 @@ public:
 
     Abc::IObject getItem( Py_ssize_t index )
     {
-        return _p.getChild( ( AbcA::index_t )index );
+        return getChildWithoutGIL( _p, ( size_t )index );
     }
 
     ChildIterator* getIterator()
@@ -98,7 +109,7 @@ static Abc::IObject getChildByIndex( Abc::IObject &o, size_t i )
         stream << i;
         throwPythonIndexException( stream.str().c_str() );
     }
-    const Abc::IObject& c = o.getChild( i );
+    const Abc::IObject c = getChildWithoutGIL( o, i );
     if ( !c.valid() )
     {
         return Abc::IObject();
@@ -109,7 +120,7 @@ static Abc::IObject getChildByIndex( Abc::IObject &o, size_t i )
 //-*****************************************************************************
 static Abc::IObject getChildByName( Abc::IObject &o, const std::string& name )
 {
-    const Abc::IObject& c = o.getChild( name );
+    const Abc::IObject c = getChildWithoutGIL( o, name );
     if ( c.valid() )
     {
         return c;
@@ -130,7 +141,7 @@ static bool isChildInstanceByIndex( Abc::IObject &o, size_t i )
         stream << i;
         throwPythonIndexException( stream.str().c_str() );
     }
-    const Abc::IObject& c = o.getChild( i );
+    const Abc::IObject c = getChildWithoutGIL( o, i );
     if ( !c.valid() )
     {
         return false;
@@ -142,7 +153,7 @@ static bool isChildInstanceByIndex( Abc::IObject &o, size_t i )
 //-*****************************************************************************
 static bool isChildInstanceByName( Abc::IObject &o, const std::string& name )
 {
-    const Abc::IObject& c = o.getChild( name );
+    const Abc::IObject c = getChildWithoutGIL( o, name );
     if ( c.valid() )
     {
         return c.isInstanceDescendant();
@@ -37,24 +37,50 @@
 #include <Foundation.h>
 #include <PyOBaseProperty.h>
 #include <PyTypeBindingTraits.h>
+#include <PyReleaseGIL.h>
+#include <PyArraySampleBuffer.h>
 
 using namespace boost::python;
 
+//-*****************************************************************************
+//! The sample is pulled out of val with the GIL held, and written without
+//! it when the archive allows.  val keeps the data the sample points at,
+//! and a buffer's view is held until the write is done so nothing can
+//! resize it in the meantime.
+template <class TPTraits>
+static void setTypedArrayValue( Abc::OArrayProperty &p, PyObject *val )
+{
+    typedef Abc::TypedArraySample<TPTraits> samp_type;
+    typedef AbcU::shared_ptr<samp_type>     samp_ptr_type;
+    typedef typename TPTraits::value_type   value_type;
+
+    BufferView view( val, TPTraits::dataType() );
+    if ( view.valid() )
+    {
+        samp_type samp( static_cast<const value_type *>( view.data() ),
+                        view.size() );
+        ReleaseGIL release( WritesConcurrently( p ) );
+        p.set( samp );
+    }
+    else if ( TypeBindingTraits<TPTraits>::memCopyable )
+    {
+        samp_type samp = extract<samp_type>( val );
+        ReleaseGIL release( WritesConcurrently( p ) );
+        p.set( samp );
+    }
+    else
+    {
+        samp_ptr_type sampPtr = extract<samp_ptr_type>( val );
+        ReleaseGIL release( WritesConcurrently( p ) );
+        p.set( *sampPtr );
+    }
+}
+
 //-*****************************************************************************
 #define CASE_SET_ARRAY_VALUE( TPTraits, iProp, iFixedArray )    \
 case TPTraits::pod_enum:                                        \
 {                                                               \
-    typedef Abc::TypedArraySample<TPTraits> samp_type;          \
-    typedef AbcU::shared_ptr<samp_type>     samp_ptr_type;      \
-    if ( TypeBindingTraits<TPTraits>::memCopyable )             \
-    {                                                           \
-        iProp.set( extract<samp_type>( iFixedArray ) );         \
-    }                                                           \
-    else                                                        \
-    {                                                           \
-       samp_ptr_type sampPtr = extract<samp_ptr_type> ( iFixedArray ); \
-       iProp.set( *sampPtr );                                   \
-    }                                                           \
+    setTypedArrayValue<TPTraits>( iProp, iFixedArray );         \
     return;                                                     \
 }
 
@@ -123,12 +149,12 @@ static void setArrayValue( Abc::OArrayProperty &p, PyObject *val )
                 std::string interp (p.getMetaData().get ("interpretation"));
                 if (!interp.compare (Abc::C3fTPTraits::interpretation()))
                 {
-                    p.set( extract<Abc::TypedArraySample<Abc::C3fTPTraits> >( val ) );
+                    setTypedArrayValue<Abc::C3fTPTraits>( p, val );
                     return;
                 }
                 else
                 {
-                    p.set( extract<Abc::TypedArraySample<Abc::V3fTPTraits> >( val ) );
+                    setTypedArrayValue<Abc::V3fTPTraits>( p, val );
                     return;
                 }
             }
@@ -149,17 +175,17 @@ static void setArrayValue( Abc::OArrayProperty &p, PyObject *val )
                 std::string interp (p.getMetaData().get ("interpretation"));
                 if (!interp.compare (Abc::C4fTPTraits::interpretation()))
                 {
-                    p.set( extract<Abc::TypedArraySample<Abc::C4fTPTraits> >( val ) );
+                    setTypedArrayValue<Abc::C4fTPTraits>( p, val );
                     return;
                 }
                 else if (!interp.compare (Abc::QuatfTPTraits::interpretation()))
                 {
-                    p.set( extract<Abc::TypedArraySample<Abc::QuatfTPTraits> >( val ) );
+                    setTypedArrayValue<Abc::QuatfTPTraits>( p, val );
                     return;
                 }
                 else if (!interp.compare (Abc::Box2fTPTraits::interpretation()))
                 {
-                    p.set( extract<Abc::TypedArraySample<Abc::Box2fTPTraits> >( val ) );
+                    setTypedArrayValue<Abc::Box2fTPTraits>( p, val );
                     return;
                 }
             }
@@ -168,12 +194,12 @@ static void setArrayValue( Abc::OArrayProperty &p, PyObject *val )
                 std::string interp (p.getMetaData().get ("interpretation"));
                 if (!interp.compare (Abc::QuatdTPTraits::interpretation()))
                 {
-                    p.set( extract<Abc::TypedArraySample<Abc::QuatdTPTraits> >( val ) );
+                    setTypedArrayValue<Abc::QuatdTPTraits>( p, val );
                     return;
                 }
                 else if (!interp.compare (Abc::Box2dTPTraits::interpretation()))
                 {
-                    p.set( extract<Abc::TypedArraySample<Abc::Box2dTPTraits> >( val ) );
+                    setTypedArrayValue<Abc::Box2dTPTraits>( p, val );
                     return;
                 }
             }
@@ -261,7 +287,9 @@ void register_oarrayproperty()
         .def( "setValue",
               &setArrayValue,
               ( arg( "array" ) ),
-              "Set a sample with the given array" )
+              "Set a sample with the given array.  Other Python threads may "
+              "run while an Ogawa archive writes it, but an archive should "
+              "only be written from one thread at a time" )
         .def( "setFromPrevious",
               &Abc::OArrayProperty::setFromPrevious,
               "Set a Sample from the previous sample" )
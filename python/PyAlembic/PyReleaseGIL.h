@@ -0,0 +1,93 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2012,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef PyAlembic_PyReleaseGIL_h_
+#define PyAlembic_PyReleaseGIL_h_
+
+#include <Foundation.h>
+
+//-*****************************************************************************
+//! Lets other Python threads run while this one is off reading or writing,
+//! until this goes away.  Nothing from Python may be touched in between.
+//! HDF5 isn't thread safe, and the GIL is the only thing keeping two Python
+//! threads out of it at once, so it is only let go of for archives which
+//! say they can be used from several threads.
+class ReleaseGIL
+{
+public:
+    explicit ReleaseGIL( bool iRelease )
+      : m_state( iRelease ? PyEval_SaveThread() : NULL ) {}
+
+    ~ReleaseGIL()
+    {
+        if ( m_state )
+        {
+            PyEval_RestoreThread( m_state );
+        }
+    }
+
+private:
+    ReleaseGIL( const ReleaseGIL & );
+    ReleaseGIL & operator=( const ReleaseGIL & );
+
+    PyThreadState *m_state;
+};
+
+//-*****************************************************************************
+//! Whether the archive iObject comes from can be read from another thread
+//! while it is being read from this one.
+inline bool ReadsConcurrently( const Abc::IObject &iObject )
+{
+    return iObject.valid() &&
+        iObject.getPtr()->getArchive()->supportsConcurrentReads();
+}
+
+inline bool ReadsConcurrently( const Abc::IArrayProperty &iProp )
+{
+    return iProp.valid() &&
+        iProp.getPtr()->getObject()->getArchive()->supportsConcurrentReads();
+}
+
+//! Whether the archive iProp is written to can be written while other
+//! archives are used by other threads, and takes turns writing samples set
+//! on it from several threads itself.
+inline bool WritesConcurrently( const Abc::OArrayProperty &iProp )
+{
+    return iProp.valid() &&
+        iProp.getPtr()->getObject()->getArchive()->supportsConcurrentWrites();
+}
+
+#endif
@@ -37,6 +37,7 @@
 #include <Foundation.h>
 #include <PyTypedArraySampleConverter.h>
 #include <PyTypeBindingTraits.h>
+#include <PyArraySampleBuffer.h>
 
 using namespace boost::python;
 
@@ -127,6 +128,57 @@ struct FixedArrayToTypedArraySamplePtr
     }
 };
 
+//-*****************************************************************************
+// Any contiguous buffer of the right kind of number, like a numpy array or
+// an ArraySampleBuffer, is used as the sample as it is.  A buffer with more
+// than one dimension needs its last one to be the extent, so a (N, 3) array
+// becomes N V3fs but a (N, 2) one isn't taken for V3fs.
+// The sample only points at the buffer's memory, and the view is let go of
+// once the sample is built.  That's only safe while the GIL is held for the
+// rest of the call, since no Python code can resize the buffer until then,
+// so anything which lets go of the GIL while using the sample has to hold a
+// BufferView of its own across it.
+template<class TPTraits>
+struct BufferToTypedArraySample
+{
+    typedef typename TPTraits::value_type               value_type;
+    typedef Abc::TypedArraySample<TPTraits>             samp_type;
+
+    BufferToTypedArraySample()
+    {
+        converter::registry::push_back( &convertible,
+                                        &construct,
+                                        type_id<samp_type>() );
+    }
+
+    static void * convertible( PyObject* obj_ptr )
+    {
+        BufferView view( obj_ptr, TPTraits::dataType() );
+        return view.valid() ? obj_ptr : 0;
+    }
+
+    static void construct( PyObject* obj_ptr,
+                           converter::rvalue_from_python_stage1_data *data )
+    {
+        BufferView view( obj_ptr, TPTraits::dataType() );
+        if ( !view.valid() )
+        {
+            throwPythonException( "Buffer doesn't match the sample type" );
+        }
+
+        void *storage = ( (converter::rvalue_from_python_storage<samp_type>*)
+                           data)->storage.bytes;
+
+        new ( storage ) samp_type(
+            static_cast<const value_type *>( view.data() ), view.size() );
+
+        data->convertible = storage;
+    }
+};
+
+//-*****************************************************************************
+struct NoBufferToTypedArraySample {};
+
 //-*****************************************************************************
 template<class TPTraits>
 struct TypedArraySampleToFixedArray
@@ -230,6 +282,12 @@ static void register_()
     typename if_<bool_<binding_traits::memCopyable>,
                        FixedArrayToTypedArraySample<TPTraits>,
                        FixedArrayToTypedArraySamplePtr<TPTraits> >::type from_pyton_converter;
+
+    // from-python converter
+    // contiguous buffer to ArraySample, for what a buffer can hold
+    typename if_<bool_<binding_traits::memCopyable>,
+                       BufferToTypedArraySample<TPTraits>,
+                       NoBufferToTypedArraySample >::type from_buffer_converter;
 }
 
 //-*****************************************************************************
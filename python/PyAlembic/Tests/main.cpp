@@ -98,6 +98,22 @@ runTests (int argc, char *argv[])
 
         PyRun_SimpleString (code.c_str());
     }
+
+    // Test 7: Array samples through the buffer protocol
+    {
+        std::string code =
+            "import testArraySampleBuffer\n";
+
+        PyRun_SimpleString (code.c_str());
+    }
+
+    // Test 8: Reading from several threads
+    {
+        std::string code =
+            "import testThreads\n";
+
+        PyRun_SimpleString (code.c_str());
+    }
   
     Py_Finalize();
 }
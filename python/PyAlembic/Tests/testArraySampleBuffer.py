@@ -0,0 +1,127 @@
+#-******************************************************************************
+#
+# Copyright (c) 2012 - 2013
+#  Sony Pictures Imageworks Inc. and
+#  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+#
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met:
+# *       Redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer.
+# *       Redistributions in binary form must reproduce the above
+# copyright notice, this list of conditions and the following disclaimer
+# in the documentation and/or other materials provided with the
+# distribution.
+# *       Neither the name of Sony Pictures Imageworks, nor
+# Industrial Light & Magic, nor the names of their contributors may be used
+# to endorse or promote products derived from this software without specific
+# prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#-******************************************************************************
+
+import hashlib
+import struct
+
+from imath import *
+from alembic.Abc import *
+from alembic.AbcGeom import *
+from meshData import *
+
+testList = []
+
+def writeMesh(filename):
+    """write an oarchive with a mesh in it"""
+
+    meshyObj = OPolyMesh( OArchive( filename ).getTop(), 'meshy' )
+    mesh = meshyObj.getSchema()
+
+    mesh.set( OPolyMeshSchemaSample( verts, indices, counts ) )
+
+def testArraySampleBuffer():
+    writeMesh( 'arraySampleBuffer.abc' )
+
+    meshyObj = IPolyMesh( IArchive( 'arraySampleBuffer.abc' ).getTop(),
+                          'meshy' )
+    mesh = meshyObj.getSchema()
+
+    # the positions are viewed in place, one row per point
+    P = mesh.getPositionsProperty().getBuffer()
+    assert len( P ) == len( verts )
+
+    view = memoryview( P )
+    assert view.readonly
+    assert view.format == 'f'
+    assert view.itemsize == 4
+    assert view.shape == ( len( verts ), 3 )
+
+    floats = struct.unpack( '%df' % ( 3 * len( verts ) ), view.tobytes() )
+    for i in range( len( verts ) ):
+        assert V3f( floats[3*i], floats[3*i+1], floats[3*i+2] ) == verts[i]
+
+    # consumers which don't ask for the shape see plain bytes
+    assert hashlib.md5( P ).digest() == hashlib.md5( view.tobytes() ).digest()
+
+    view = memoryview( mesh.getFaceIndicesProperty().getBuffer() )
+    assert view.format == 'i'
+    assert view.shape == ( len( indices ), )
+
+    # and any buffer of the right kind of number can be written as is
+    oarch = OArchive( 'arraySampleBufferCopy.abc' )
+    oprops = oarch.getTop().getProperties()
+
+    copyP = OP3fArrayProperty( oprops, 'P' )
+    copyP.setValue( P )
+
+    chars = OUcharArrayProperty( oprops, 'chars' )
+    chars.setValue( bytearray( 'alembic' ) )
+
+    # with more than one dimension the last one has to be the extent, so
+    # the ( N, 3 ) positions aren't taken for 3 * N floats
+    floats = OFloatArrayProperty( oprops, 'floats' )
+    try:
+        floats.setValue( P )
+    except TypeError:
+        pass
+    else:
+        assert False
+
+    del copyP, chars, floats, oprops, oarch
+
+    iprops = IArchive( 'arraySampleBufferCopy.abc' ).getTop().getProperties()
+
+    copied = IP3fArrayProperty( iprops, 'P' ).getValue()
+    assert len( copied ) == len( verts )
+    for i in range( len( verts ) ):
+        assert copied[i] == verts[i]
+
+    view = memoryview( IUcharArrayProperty( iprops, 'chars' ).getBuffer() )
+    assert view.tobytes() == 'alembic'
+
+testList.append( ( 'testArraySampleBuffer', testArraySampleBuffer ) )
+
+# -------------------------------------------------------------------------
+# Main loop
+
+for test in testList:
+    funcName = test[0]
+    print ""
+    print "Running %s" % funcName
+    test[1]()
+    print "passed"
+
+print ""
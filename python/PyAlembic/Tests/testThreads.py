@@ -0,0 +1,175 @@
+#-******************************************************************************
+#
+# Copyright (c) 2012 - 2013
+#  Sony Pictures Imageworks Inc. and
+#  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+#
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met:
+# *       Redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer.
+# *       Redistributions in binary form must reproduce the above
+# copyright notice, this list of conditions and the following disclaimer
+# in the documentation and/or other materials provided with the
+# distribution.
+# *       Neither the name of Sony Pictures Imageworks, nor
+# Industrial Light & Magic, nor the names of their contributors may be used
+# to endorse or promote products derived from this software without specific
+# prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#-******************************************************************************
+
+import threading
+
+from imath import *
+from alembic.Abc import *
+
+testList = []
+
+numObjects = 16
+
+def writeArchive( filename, asOgawa ):
+    """write an oarchive with an int array under each of a few objects"""
+
+    top = OArchive( filename, asOgawa = asOgawa ).getTop()
+
+    for i in range( numObjects ):
+        child = OObject( OObject( top, 'obj%d' % i ), 'child' )
+
+        vals = IntArray( 100 * ( i + 1 ) )
+        for j in range( len( vals ) ):
+            vals[j] = i
+        OInt32ArrayProperty( child.getProperties(), 'vals' ).setValue( vals )
+
+def readArchive( filename ):
+    archive = IArchive( filename )
+
+    names = [ '/obj%d/child' % i for i in range( numObjects ) ]
+    objs = archive.findObjects( names + [ '/missing' ], numThreads = 4 )
+    assert len( objs ) == numObjects + 1
+    assert not objs[-1].valid()
+    for name, obj in zip( names, objs ):
+        assert obj.getFullName() == name
+
+    props = [ IInt32ArrayProperty( obj.getProperties(), 'vals' )
+              for obj in objs[:-1] ]
+    values = GetArrayValues( props, numThreads = 4 )
+    assert len( values ) == numObjects
+    for i in range( numObjects ):
+        assert len( values[i] ) == 100 * ( i + 1 )
+        assert values[i][0] == i
+        assert values[i][-1] == i
+
+    return values
+
+def testBulkRead():
+    writeArchive( 'threadsOgawa.abc', True )
+    writeArchive( 'threadsHDF5.abc', False )
+
+    readArchive( 'threadsOgawa.abc' )
+    readArchive( 'threadsHDF5.abc' )
+
+    # properties of both kinds of archive can be read together, HDF5 ones
+    # just aren't handed to the threads
+    ogawaTop = IArchive( 'threadsOgawa.abc' ).getTop()
+    hdfTop = IArchive( 'threadsHDF5.abc' ).getTop()
+    props = []
+    for i in range( numObjects ):
+        for top in ( ogawaTop, hdfTop ):
+            child = top.getChild( 'obj%d' % i ).getChild( 'child' )
+            props.append( IInt32ArrayProperty( child.getProperties(),
+                                               'vals' ) )
+
+    values = GetArrayValues( props )
+    for i in range( len( props ) ):
+        assert len( values[i] ) == 100 * ( i / 2 + 1 )
+
+def testPythonThreads():
+    writeArchive( 'threadsOgawa.abc', True )
+
+    results = []
+    errors = []
+    def work():
+        try:
+            for i in range( 10 ):
+                values = readArchive( 'threadsOgawa.abc' )
+                results.append( sum( len( v ) for v in values ) )
+        except Exception, e:
+            errors.append( e )
+
+    threads = [ threading.Thread( target = work ) for i in range( 4 ) ]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+    assert not errors, errors
+    assert results == [ 100 * numObjects * ( numObjects + 1 ) / 2 ] * 40
+
+def testPythonThreadsWrite():
+    # threads set samples on the properties of one archive at once, which
+    # takes turns writing them
+    top = OArchive( 'threadsWrite.abc' ).getTop()
+    props = [ OInt32ArrayProperty( top.getProperties(), 'vals%d' % i )
+              for i in range( 4 ) ]
+
+    errors = []
+    def work( prop ):
+        try:
+            for i in range( 100 ):
+                vals = IntArray( 1000 )
+                for j in range( len( vals ) ):
+                    vals[j] = i
+                prop.setValue( vals )
+        except Exception, e:
+            errors.append( e )
+
+    threads = [ threading.Thread( target = work, args = ( prop, ) )
+                for prop in props ]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+    assert not errors, errors
+    del props, top
+
+    iprops = IArchive( 'threadsWrite.abc' ).getTop().getProperties()
+    for i in range( 4 ):
+        prop = IInt32ArrayProperty( iprops, 'vals%d' % i )
+        assert prop.getNumSamples() == 100
+        for j in range( 100 ):
+            vals = prop.getValue( j )
+            assert len( vals ) == 1000
+            assert vals[0] == j and vals[-1] == j
+
+testList.append( ( 'testBulkRead', testBulkRead ) )
+testList.append( ( 'testPythonThreads', testPythonThreads ) )
+testList.append( ( 'testPythonThreadsWrite', testPythonThreadsWrite ) )
+
+# -------------------------------------------------------------------------
+# Main loop
+
+for test in testList:
+    funcName = test[0]
+    print ""
+    print "Running %s" % funcName
+    test[1]()
+    print "passed"
+
+print ""
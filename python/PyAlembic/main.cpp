@@ -55,6 +55,7 @@ void register_ocompoundproperty();
 void register_isampleselector();
 void register_iscalarproperty();
 void register_iarrayproperty();
+void register_arraysamplebuffer();
 void register_oscalarproperty();
 void register_oarrayproperty();
 void register_itypedscalarproperty();
@@ -163,6 +164,7 @@ BOOST_PYTHON_MODULE( alembic )
         register_ocompoundproperty();
         register_isampleselector();
         register_iscalarproperty();
+        register_arraysamplebuffer();
         register_iarrayproperty();
         register_oscalarproperty();
         register_oarrayproperty();